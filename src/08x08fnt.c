@@ -22,7 +22,7 @@
 
 #include "08x08fnt.h"
 
-const uint8_t Font_08x08[96][8]=
+const uint8_t Font_08x08[FONT_08X08_COUNT][8]=
   {{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, //  32 = 0x20 = " "
    {0x00,0x00,0x06,0x5F,0x5F,0x06,0x00,0x00}, //  33 = 0x21 = "!"
    {0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x00}, //  34 = 0x22 = """
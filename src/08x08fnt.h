@@ -26,6 +26,8 @@
 
 //Base character is: 32 = 0x20 = " "
 #define FONT_08X08_BASE 32
-extern const uint8_t Font_08x08[96][8];
+//Glyphs in the font, the printable ASCII 32 to 127
+#define FONT_08X08_COUNT 96
+extern const uint8_t Font_08x08[FONT_08X08_COUNT][8];
 
 #endif /* __08x08fnt_h__ */
@@ -0,0 +1,41 @@
+/*
+ * Description:
+ *
+ * Boot timeline, the time at which each stage of bring-up completed
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "boot_timeline.h"
+#include "systick.h"
+
+/* the systick of each event plus one, 0 until it happens */
+static volatile uint32_t event_ticks[BOOT_EVENT_COUNT];
+
+/* record the current systick as the time of event, only the first call for each event counts */
+void BootTimelineMark(boot_event_t event)
+{
+    if (event < BOOT_EVENT_COUNT && !event_ticks[event])
+        event_ticks[event] = getSysTick_mSecs() + 1;
+}
+
+/* mSecs from the start of the systick to event, or BOOT_TIME_NONE */
+uint32_t BootTimelineGet(boot_event_t event)
+{
+    if (event >= BOOT_EVENT_COUNT || !event_ticks[event])
+        return BOOT_TIME_NONE;
+    return event_ticks[event] - 1;
+}
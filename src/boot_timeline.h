@@ -0,0 +1,51 @@
+/*
+ * Description:
+ *
+ * Boot timeline, the time at which each stage of bring-up completed
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __BOOT_TIMELINE_H__
+#define __BOOT_TIMELINE_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the stages of boot that are timed */
+typedef enum
+{
+    BOOT_USB_STARTED,       /* USB_VCOMinit() returned, enumeration can begin */
+    BOOT_LCD_READY,         /* the LCD controller bring-up completed */
+    BOOT_FIRST_FRAME,       /* the first frame went out to the glass */
+    BOOT_USB_CONFIGURED,    /* the host configured the USB device */
+    BOOT_EVENT_COUNT
+} boot_event_t;
+
+/* returned for events that have not happened yet */
+#define BOOT_TIME_NONE 0xffffffff
+
+/* record the current systick as the time of event, only the first call for each event counts */
+void BootTimelineMark(boot_event_t event);
+/* mSecs from the start of the systick to event, or BOOT_TIME_NONE */
+uint32_t BootTimelineGet(boot_event_t event);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __BOOT_TIMELINE_H__
@@ -0,0 +1,225 @@
+/*
+ * Description:
+ *
+ * Scrolling time series chart widget. Samples go into a circular buffer and the
+ * lowest and highest samples on the plot are kept by two monotonic queues, so
+ * adding a sample costs the same however wide the plot is. With an 8-bit
+ * framebuffer the plot is moved left once per frame by the samples added and
+ * only the new columns are drawn, otherwise the plot is drawn again.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "chart.h"
+#include "lcd_draw.h"
+#include "simple_lcd.h"
+#include "st7529_core.h"
+
+/* plot columns are moved in place in the framebuffer */
+#define CHART_SHIFT_IN_PLACE    (LCD_FRAMEBUFFER && LCD_FB_BPP == 8)
+
+#if CHART_SHIFT_IN_PLACE
+/* for unaligned word loads */
+typedef struct { uint32_t word; } __attribute__((packed)) unaligned_word_t;
+#endif
+
+/* set up a w x h chart at x,y */
+void ChartInit(struct Chart* chart, int x, int y, unsigned int w, unsigned int h)
+{
+    memset(chart, 0, sizeof(*chart));
+    if (w > CHART_MAX_COLUMNS + 2)
+        w = CHART_MAX_COLUMNS + 2;
+    WidgetInitPanel(&chart->widget, x, y, w, h, 1);
+    chart->widget.type = WIDGET_CHART;
+    chart->widget.u.chart = chart;
+    chart->columns = w > 2 ? w - 2 : 0;
+    chart->lo = 0;
+    chart->hi = 1;
+}
+
+/* push a sample onto a monotonic queue, dropping the samples it makes irrelevant from the back and the
+ * samples that scrolled off the plot from the front. below picks a min queue (non-zero) or a max queue */
+static void queuePush(struct ChartExtreme* q, uint16_t* head, uint16_t* count, uint16_t columns,
+                      uint16_t seq, int16_t value, int below)
+{
+    unsigned int back;
+
+    while (*count)
+    {
+        back = *head + *count - 1;
+        if (back >= columns)
+            back -= columns;
+        if (below ? q[back].value < value : q[back].value > value)
+            break;
+        --*count;
+    }
+    while (*count && (uint16_t)(seq - q[*head].seq) >= columns)
+    {
+        if (++*head == columns)
+            *head = 0;
+        --*count;
+    }
+
+    back = *head + *count;
+    if (back >= columns)
+        back -= columns;
+    q[back].seq = seq;
+    q[back].value = value;
+    ++*count;
+}
+
+/* return the lowest and highest sample on the plot */
+int ChartGetRange(const struct Chart* chart, int16_t* min, int16_t* max)
+{
+    if (!chart->count)
+        return 0;
+    *min = chart->min_q[chart->min_head].value;
+    *max = chart->max_q[chart->max_head].value;
+    return 1;
+}
+
+/* add a sample */
+void ChartAddSample(struct Chart* chart, int16_t sample)
+{
+    int16_t min = sample, max = sample;
+    int32_t range, margin;
+
+    if (!chart->columns)
+        return;
+
+    chart->samples[chart->head] = sample;
+    if (++chart->head > chart->columns)
+        chart->head = 0;
+    if (chart->count <= chart->columns)
+        ++chart->count;
+    queuePush(chart->min_q, &chart->min_head, &chart->min_count, chart->columns, chart->seq, sample, 1);
+    queuePush(chart->max_q, &chart->max_head, &chart->max_count, chart->columns, chart->seq, sample, 0);
+    ++chart->seq;
+    if (chart->pending < chart->columns)
+        ++chart->pending;
+
+    /* the scale follows the samples on the plot with some headroom, changing it only when they leave it
+     * or shrink to a quarter of it, so a noisy signal does not redraw the whole plot every sample */
+    ChartGetRange(chart, &min, &max);
+    range = (int32_t)max - min;
+    if (min < chart->lo || max > chart->hi || (int32_t)chart->hi - chart->lo > 4 * (range + 1))
+    {
+        margin = range / 8 + 1;
+        chart->lo = min - margin < INT16_MIN ? INT16_MIN : min - margin;
+        chart->hi = max + margin > INT16_MAX ? INT16_MAX : max + margin;
+        chart->rescale = 1;
+        WidgetInvalidate(&chart->widget);
+    }
+    else
+        WidgetUpdate(&chart->widget);
+}
+
+/* the plot row of a sample */
+static int sampleRow(const struct Chart* chart, int16_t sample)
+{
+    int rows = chart->widget.h - 2;
+    int32_t offset = ((int32_t)chart->hi - sample) * (rows - 1) / ((int32_t)chart->hi - chart->lo);
+
+    if (offset < 0)
+        offset = 0;
+    else if (offset > rows - 1)
+        offset = rows - 1;
+    return chart->widget.y + 1 + offset;
+}
+
+/* draw the plot column of the sample age samples before the newest, a line from the sample before it */
+static void drawColumn(const struct Chart* chart, unsigned int age)
+{
+    int x = chart->widget.x + chart->columns - age;
+    unsigned int rows = chart->widget.h - 2;
+    int slot, row, prev;
+
+    DrawVSpan(x, chart->widget.y + 1, rows, WHITE);
+    if (age >= chart->count)
+        return;
+
+    slot = (int)chart->head - 1 - (int)age;
+    if (slot < 0)
+        slot += chart->columns + 1;
+    row = prev = sampleRow(chart, chart->samples[slot]);
+    if (age + 1 < chart->count)
+        prev = sampleRow(chart, chart->samples[slot ? slot - 1 : chart->columns]);
+
+    if (prev < row)
+        DrawVSpan(x, prev + 1 < row ? prev + 1 : row, row - prev, BLACK);
+    else if (prev > row)
+        DrawVSpan(x, row, prev - row, BLACK);
+    else
+        DrawPixel(x, row, BLACK);
+}
+
+#if CHART_SHIFT_IN_PLACE
+/* move the plot left by n columns in the framebuffer, a word at a time. Returns 0 if the plot is not
+ * wholly on the glass */
+static int shiftPlot(const struct Chart* chart, unsigned int n)
+{
+    uint8_t* fb = LCDGetFramebuffer();
+    int x = chart->widget.x + 1, y = chart->widget.y + 1;
+    unsigned int rows = chart->widget.h - 2, count = chart->columns - n, row;
+
+    if (x < 0 || y < 0 || x + chart->columns > LCD_USABLE_PIXELS_PER_ROW || y + rows > LCD_LINES)
+        return 0;
+
+    for (row = 0; row < rows; ++row)
+    {
+        uint8_t* to = fb + (y + row) * LCD_FB_STRIDE + x;
+        const uint8_t* from = to + n;
+        unsigned int left = count;
+
+        /* copying forwards is safe, every load is ahead of the stores before it */
+        for (; left && ((x + count - left) & 3); --left)
+            *to++ = *from++;
+        for (; left >= 4; left -= 4, to += 4, from += 4)
+            *(uint32_t*)(void*)to = ((const unaligned_word_t*)(const void*)from)->word;
+        for (; left; --left)
+            *to++ = *from++;
+    }
+    LCDMarkDirty(x, y, chart->columns, rows);
+    return 1;
+}
+#endif
+
+/* draw the chart */
+void ChartDraw(struct Chart* chart, int full)
+{
+    unsigned int age, columns = chart->columns;
+
+    if (!columns || chart->widget.h < 3)
+        return;
+
+#if CHART_SHIFT_IN_PLACE
+    if (!full && !chart->rescale && chart->pending < columns && shiftPlot(chart, chart->pending))
+    {
+        /* the oldest new sample's line starts at the sample before it, already on the plot */
+        for (age = 0; age < chart->pending; ++age)
+            drawColumn(chart, age);
+        chart->pending = 0;
+        return;
+    }
+#endif
+
+    DrawRect(chart->widget.x, chart->widget.y, chart->widget.w, chart->widget.h, BLACK);
+    for (age = 0; age < columns; ++age)
+        drawColumn(chart, age);
+    chart->pending = 0;
+    chart->rescale = 0;
+}
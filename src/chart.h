@@ -0,0 +1,75 @@
+/*
+ * Description:
+ *
+ * Scrolling time series chart widget, samples kept in a circular buffer
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __CHART_H__
+#define __CHART_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "widgets.h"
+
+/* the widest plot, in columns */
+#ifndef CHART_MAX_COLUMNS
+#define CHART_MAX_COLUMNS   128
+#endif
+
+/* a sample remembered by a min or max queue */
+struct ChartExtreme
+{
+    uint16_t seq;
+    int16_t value;
+};
+
+/* a chart, owned by the caller. The plot is the widget's box less a one pixel frame, a column per sample
+ * with the newest on the right */
+struct Chart
+{
+    struct Widget widget;
+    int16_t samples[CHART_MAX_COLUMNS + 1];         /* the last columns + 1 samples, circular, the extra one
+                                                     * starts the line of the leftmost column */
+    struct ChartExtreme min_q[CHART_MAX_COLUMNS];   /* the window's rising minima, oldest first, circular */
+    struct ChartExtreme max_q[CHART_MAX_COLUMNS];   /* the window's falling maxima */
+    uint16_t min_head, min_count;
+    uint16_t max_head, max_count;
+    uint16_t head;      /* the slot of the next sample */
+    uint16_t seq;       /* the sequence number of the next sample */
+    uint16_t count;     /* samples held, at most columns + 1 */
+    uint16_t columns;   /* plot columns */
+    uint16_t pending;   /* samples added since the plot was drawn */
+    int16_t lo, hi;     /* the scale, lo on the bottom row and hi on the top */
+    uint8_t rescale;    /* the scale changed, the whole plot has to be drawn again */
+};
+
+/* set up a w x h chart at x,y, at most CHART_MAX_COLUMNS + 2 wide, add it to a tree with WidgetAdd(&chart->widget) */
+void ChartInit(struct Chart* chart, int x, int y, unsigned int w, unsigned int h);
+/* add a sample, the oldest one scrolls off the left once the plot is full */
+void ChartAddSample(struct Chart* chart, int16_t sample);
+/* return the lowest and highest sample on the plot, 0 if there are none */
+int ChartGetRange(const struct Chart* chart, int16_t* min, int16_t* max);
+/* draw the chart for WidgetRender(), the whole of it or only the samples added since it was last drawn */
+void ChartDraw(struct Chart* chart, int full);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __CHART_H__
@@ -0,0 +1,215 @@
+/*
+ * Description:
+ *
+ * Bitmap font drawing. Glyphs are decoded from flash into a small cache of
+ * rows of bits, then expanded to gray bytes and blitted a glyph at a time.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "font.h"
+#include "simple_lcd.h"
+#include "st7529_core.h"
+#include "glassLayout.h"
+
+/* decoded glyphs kept in RAM, a direct mapped cache */
+#define FONT_CACHE_ENTRIES  8
+
+struct FontCacheEntry
+{
+    const struct Font* font;
+    unsigned int c;
+    uint32_t rows[FONT_MAX_HEIGHT * FONT_MAX_BPP];  /* bpp words a row, the leftmost pixel in the top bits */
+};
+
+static struct FontCacheEntry cache[FONT_CACHE_ENTRIES];
+static struct FontCacheStats cache_stats;
+
+/* gray bytes for each coverage of 1, 2 and 4 bit fonts, from the paper (0) to the ink (all ones) */
+static uint8_t blend1[2] = { WHITE, BLACK };
+static uint8_t blend2[4];
+static uint8_t blend4[16];
+static int blend_valid = 0;
+
+/* a glyph expanded to gray bytes for the blit */
+static uint8_t glyph_gray[FONT_MAX_WIDTH * FONT_MAX_HEIGHT];
+
+/* the glyph of c, 0 if the font does not have it */
+static const struct FontGlyph* findGlyph(const struct Font* font, char c)
+{
+    unsigned int i = (unsigned char)c - font->first;
+    return i < font->count ? &font->glyphs[i] : 0;
+}
+
+/* decode a glyph from flash into rows of coverage, bpp words a row */
+static void decodeGlyph(const struct Font* font, const struct FontGlyph* glyph, uint32_t* rows)
+{
+    const uint8_t* src = font->bits + glyph->offset;
+    unsigned int bpp = font->bpp;
+    unsigned int row, col, run = 0;
+    uint32_t level = 0;
+    uint8_t bits = 0;
+    unsigned int bit = 0;
+
+    for (row = 0; row < font->height; ++row, rows += bpp)
+    {
+        memset(rows, 0, bpp * sizeof(*rows));
+
+        for (col = 0; col < glyph->width; ++col)
+        {
+            unsigned int pos = col * bpp;
+
+            if (font->encoding == FONT_RLE)
+            {
+                if (!run)
+                {
+                    run = (*src & (0xff >> bpp)) + 1;
+                    level = *src++ >> (8 - bpp);
+                }
+                --run;
+            }
+            else
+            {
+                if (!bit)
+                {
+                    bits = *src++;
+                    bit = 8;
+                }
+                bit -= bpp;
+                level = (bits >> bit) & ((1 << bpp) - 1);
+            }
+            rows[pos / 32] |= level << (32 - bpp - pos % 32);
+        }
+    }
+}
+
+/* the blend table of a font's coverage bits */
+static const uint8_t* blendTable(unsigned int bpp)
+{
+    if (!blend_valid)
+        FontSetColors(BLACK, WHITE);
+    return bpp == 1 ? blend1 : bpp == 2 ? blend2 : blend4;
+}
+
+/* the decoded rows of a glyph, from the cache when it holds them */
+static const uint32_t* glyphRows(const struct Font* font, const struct FontGlyph* glyph, unsigned int c)
+{
+    struct FontCacheEntry* e = &cache[(c ^ font->height) % FONT_CACHE_ENTRIES];
+
+    if (e->font == font && e->c == c)
+    {
+        cache_stats.hits++;
+        return e->rows;
+    }
+
+    cache_stats.misses++;
+    decodeGlyph(font, glyph, e->rows);
+    e->font = font;
+    e->c = c;
+    return e->rows;
+}
+
+/* set the ink and paper grays, working out the blend of the two for every coverage */
+void FontSetColors(uint8_t ink, uint8_t paper)
+{
+    int a;
+
+    for (a = 0; a < 16; ++a)
+        blend4[a] = paper + (((int)ink - paper) * a + (ink > paper ? 7 : -7)) / 15;
+    for (a = 0; a < 4; ++a)
+        blend2[a] = blend4[a * 5];
+    blend1[0] = paper;
+    blend1[1] = ink;
+    blend_valid = 1;
+}
+
+/* draw character c with its top left at x,y */
+unsigned int FontDrawChar(const struct Font* font, unsigned int x, unsigned int y, char c)
+{
+    const struct FontGlyph* glyph = findGlyph(font, c);
+    const uint8_t* blend = blendTable(font->bpp);
+    const uint32_t* rows;
+    uint8_t* out = glyph_gray;
+    unsigned int row, col, width, bpp = font->bpp, shift = 32 - font->bpp;
+
+    if (!glyph || !glyph->width)
+        glyph = findGlyph(font, ' ');
+    if (!glyph || !glyph->width)
+        return 0;
+    width = glyph->width;
+
+    /* every pixel is a lookup of its coverage, the same work for 1, 2 and 4 bit fonts */
+    rows = glyphRows(font, glyph, (unsigned char)c);
+    for (row = 0; row < font->height; ++row, rows += bpp)
+    {
+        const uint32_t* word = rows;
+        uint32_t bits = *word++;
+        unsigned int left = 32 / bpp;
+
+        for (col = 0; col < width; ++col)
+        {
+            if (!left)
+            {
+                bits = *word++;
+                left = 32 / bpp;
+            }
+            *out++ = blend[bits >> shift];
+            bits <<= bpp;
+            --left;
+        }
+    }
+
+    /* the blit clips to the glass */
+    LCDBlit(x, y, width, font->height, glyph_gray);
+    return width;
+}
+
+/* draw a string with its top left at x,y */
+unsigned int FontDrawString(const struct Font* font, unsigned int x, unsigned int y, const char* string)
+{
+    unsigned int start = x;
+
+    while (*string != '\0' && x < LCD_USABLE_PIXELS_PER_ROW)
+        x += FontDrawChar(font, x, y, *string++);
+    return x - start;
+}
+
+/* return the width of character c, drawn as a space if the font does not have it */
+unsigned int FontCharWidth(const struct Font* font, char c)
+{
+    const struct FontGlyph* glyph = findGlyph(font, c);
+
+    if (!glyph || !glyph->width)
+        glyph = findGlyph(font, ' ');
+    return glyph ? glyph->width : 0;
+}
+
+/* return the width of a string in pixels */
+unsigned int FontStringWidth(const struct Font* font, const char* string)
+{
+    unsigned int w = 0;
+
+    for (; *string != '\0'; ++string)
+        w += FontCharWidth(font, *string);
+    return w;
+}
+
+/* copy out the glyph cache counters */
+void FontGetCacheStats(struct FontCacheStats* stats)
+{
+    *stats = cache_stats;
+}
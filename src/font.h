@@ -0,0 +1,90 @@
+/*
+ * Description:
+ *
+ * Bitmap fonts of any height up to FONT_MAX_HEIGHT with proportional widths,
+ * stored packed or run length encoded in flash and drawn through simple_lcd
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __FONT_H__
+#define __FONT_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the largest glyph cell */
+#define FONT_MAX_HEIGHT     24
+#define FONT_MAX_WIDTH      32
+/* the most coverage bits per pixel, anti-aliased fonts have 2 or 4 */
+#define FONT_MAX_BPP        4
+
+/* glyph encodings */
+#define FONT_PACKED         0   /* the glyph pixels row after row, bpp bits each, MSB first, no padding between rows */
+#define FONT_RLE            1   /* runs over the same pixels, a byte each: the coverage in the top bpp bits, the
+                                 * length - 1 below (bit 7 ink and bits 0-6 the length - 1 for 1 bit fonts) */
+
+/* a glyph, width pixels across and the font's height down, width is also the pen advance */
+struct FontGlyph
+{
+    uint16_t offset;    /* the glyph's first byte in the font's bits */
+    uint8_t width;
+};
+
+/* a font, made from a BDF font by tools/bdf2font */
+struct Font
+{
+    uint8_t height;
+    uint8_t first;      /* the first character */
+    uint8_t count;      /* characters from first */
+    uint8_t encoding;   /* FONT_PACKED or FONT_RLE */
+    uint8_t bpp;        /* coverage bits per pixel: 1, or 2 or 4 for anti-aliased fonts */
+    const struct FontGlyph* glyphs;
+    const uint8_t* bits;
+};
+
+/* glyph cache counters */
+struct FontCacheStats
+{
+    uint32_t hits;
+    uint32_t misses;    /* glyphs decoded from flash */
+};
+
+/* the fonts built in */
+extern const struct Font Font_Prop8;    /* the 8x8 font with proportional widths */
+extern const struct Font Font_Prop16;   /* the same at twice the size, for values read from a distance */
+extern const struct Font Font_Prop12;   /* anti-aliased, 4 bit coverage */
+
+/* set the gray of the ink and of the paper behind it, glyph edges are blended between the two.
+ * BLACK on WHITE until set */
+void FontSetColors(uint8_t ink, uint8_t paper);
+/* draw character c with its top left at x,y in the font colors over the whole cell, returns its width */
+unsigned int FontDrawChar(const struct Font* font, unsigned int x, unsigned int y, char c);
+/* draw a string with its top left at x,y, returns the width drawn */
+unsigned int FontDrawString(const struct Font* font, unsigned int x, unsigned int y, const char* string);
+/* return the width of character c in pixels */
+unsigned int FontCharWidth(const struct Font* font, char c);
+/* return the width of a string in pixels */
+unsigned int FontStringWidth(const struct Font* font, const char* string);
+/* copy out the glyph cache counters */
+void FontGetCacheStats(struct FontCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __FONT_H__
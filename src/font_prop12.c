@@ -0,0 +1,474 @@
+/*
+ * Description:
+ *
+ * Font Font_Prop12, 12 rows, characters 32 to 126, 4 bits per pixel, run length encoded.
+ * Generated by tools/bdf2font, do not edit.
+ */
+#include "font.h"
+
+static const uint8_t Font_Prop12_bits[4341] = {
+    0x0f, 0x0f, 0x0f, 0x0b, 0x00, 0x80, 0xf1, 0x80, 0x02, 0x80, 0xb0, 0xf1,
+    0xb0, 0x80, 0x01, 0xf5, 0x01, 0xf5, 0x01, 0x80, 0xb0, 0xf1, 0xb0, 0x80,
+    0x02, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x40, 0x81, 0x40,
+    0x0b, 0x80, 0xf1, 0x80, 0x03, 0x40, 0x81, 0x40, 0x0a, 0xf2, 0x00, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x00, 0x40,
+    0x81, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x02, 0xf9, 0x80, 0x00, 0x80, 0xb0, 0xf1, 0xb0, 0x80, 0xf2, 0x80, 0x40,
+    0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf9, 0x80, 0x00, 0x80, 0xb0,
+    0xf1, 0xb0, 0x80, 0xf2, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x40, 0x81, 0x40, 0x00, 0x82,
+    0x0e, 0x03, 0x80, 0xf1, 0x80, 0x04, 0x40, 0x81, 0xb0, 0xf1, 0xb0, 0x81,
+    0x40, 0x01, 0x80, 0xf7, 0x80, 0x00, 0xf2, 0x08, 0x80, 0xb0, 0xf0, 0x85,
+    0x03, 0x80, 0xf6, 0x09, 0x80, 0xf1, 0x80, 0x00, 0x86, 0xb0, 0xf0, 0x80,
+    0x40, 0x00, 0xf8, 0x06, 0x80, 0xf1, 0x80, 0x07, 0x40, 0x81, 0x40, 0x0f,
+    0x0b, 0x82, 0x03, 0x40, 0x81, 0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80,
+    0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x06, 0x80, 0xf1, 0x80,
+    0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x06, 0x80, 0xf1, 0x80,
+    0x06, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40,
+    0x0c, 0x02, 0xf3, 0x80, 0x04, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0xf0, 0xb0,
+    0x80, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x05, 0xf3, 0x80, 0x04, 0x40,
+    0x80, 0xf2, 0x83, 0x40, 0x01, 0x80, 0xf3, 0x00, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03,
+    0x80, 0xf3, 0x00, 0x80, 0xf1, 0x80, 0x01, 0x40, 0x83, 0x00, 0x40, 0x81,
+    0x40, 0x0c, 0x00, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x02, 0x82, 0x0f, 0x0f, 0x0c, 0x02, 0xf2, 0x02,
+    0x40, 0x80, 0xf0, 0xb0, 0x80, 0x02, 0x80, 0xf1, 0x80, 0x02, 0xf2, 0x04,
+    0xf2, 0x04, 0xf2, 0x04, 0xf2, 0x04, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x03,
+    0x80, 0xf1, 0x80, 0x05, 0xf2, 0x04, 0x82, 0x09, 0xf2, 0x04, 0x80, 0xb0,
+    0xf0, 0x80, 0x40, 0x03, 0x80, 0xf1, 0x80, 0x05, 0xf2, 0x04, 0xf2, 0x04,
+    0xf2, 0x04, 0xf2, 0x02, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x02, 0x80, 0xf1,
+    0x80, 0x02, 0xf2, 0x04, 0x82, 0x0c, 0x0b, 0x83, 0x40, 0x00, 0x83, 0x40,
+    0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80, 0x01, 0x80, 0xf6, 0x02, 0x80, 0xb0,
+    0xf6, 0x80, 0x40, 0x00, 0xf9, 0x80, 0x01, 0x80, 0xf6, 0x02, 0x80, 0xb0,
+    0xf1, 0xb0, 0x80, 0xf2, 0x80, 0x40, 0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80,
+    0x0f, 0x0f, 0x04, 0x0d, 0x82, 0x07, 0xf2, 0x07, 0xf2, 0x04, 0x82, 0xf2,
+    0x82, 0x01, 0xf8, 0x04, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x0f, 0x0f, 0x05,
+    0x0f, 0x0f, 0x04, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x02, 0x82, 0x08, 0x0f, 0x0f, 0x0f, 0x89, 0x40,
+    0x00, 0xf9, 0x80, 0x0f, 0x0f, 0x0f, 0x0f, 0x08, 0x0f, 0x0f, 0x09, 0x83,
+    0x40, 0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80, 0x00, 0x83, 0x40, 0x06, 0x06,
+    0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x06, 0xf2, 0x06,
+    0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x06, 0xf2, 0x06,
+    0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x06, 0xf2, 0x08,
+    0xf0, 0x80, 0x09, 0x80, 0x40, 0x0f, 0x05, 0x00, 0x80, 0xf6, 0x02, 0x80,
+    0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x02, 0xf3, 0x80, 0x00, 0xf2, 0x00, 0x40, 0x80, 0xf3,
+    0x80, 0x00, 0xf2, 0x00, 0x80, 0xf4, 0x80, 0x00, 0xf5, 0x00, 0x80, 0xf1,
+    0x80, 0x00, 0xf3, 0xb0, 0x80, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf3, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0x02,
+    0xf2, 0x04, 0x82, 0xf2, 0x04, 0xf5, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2,
+    0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x04, 0xf8, 0x01, 0x88, 0x0c, 0x00,
+    0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0, 0xb0,
+    0x80, 0x06, 0x80, 0xf1, 0x80, 0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0, 0xb0,
+    0x80, 0x00, 0x40, 0x81, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1,
+    0x80, 0x00, 0xf9, 0x80, 0x00, 0x89, 0x40, 0x0c, 0x00, 0x80, 0xf6, 0x02,
+    0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03, 0x80,
+    0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x03, 0x83, 0xb0, 0xf0, 0x80, 0x40,
+    0x03, 0xf5, 0x09, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86,
+    0x0e, 0x05, 0xf2, 0x06, 0x40, 0x80, 0xf2, 0x06, 0x80, 0xf3, 0x05, 0xf5,
+    0x03, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x02, 0xf9, 0x80, 0x00, 0x85, 0xf2, 0x80, 0x40, 0x06, 0xf2, 0x08,
+    0xf2, 0x08, 0x82, 0x0e, 0xf9, 0x80, 0x00, 0xf2, 0x86, 0x40, 0x00, 0xf2,
+    0x08, 0xf8, 0x02, 0x86, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80,
+    0x07, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0x00,
+    0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x08, 0xf2, 0x85, 0x02, 0xf8,
+    0x02, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86,
+    0x0e, 0xf9, 0x80, 0x00, 0xf2, 0x83, 0xb0, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf0, 0x80,
+    0x40, 0x06, 0xf2, 0x06, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x40, 0x81, 0x40, 0x0f,
+    0x00, 0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf6,
+    0x02, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86,
+    0x0e, 0x00, 0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80,
+    0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf1, 0x80, 0x01, 0x80, 0xf7,
+    0x80, 0x07, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e,
+    0x05, 0x83, 0x40, 0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80, 0x00, 0x83, 0x40,
+    0x0c, 0x83, 0x40, 0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80, 0x00, 0x83, 0x40,
+    0x06, 0x06, 0x40, 0x81, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1,
+    0x80, 0x01, 0x40, 0x81, 0x40, 0x0d, 0x40, 0x81, 0x40, 0x01, 0x80, 0xf1,
+    0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x00,
+    0xf2, 0x02, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xb0, 0xf0, 0x80, 0x40,
+    0x03, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xb0, 0xf0, 0x80, 0x40,
+    0x03, 0xf2, 0x06, 0x80, 0xf1, 0x80, 0x04, 0x40, 0x80, 0xf0, 0xb0, 0x80,
+    0x05, 0xf2, 0x06, 0x80, 0xf1, 0x80, 0x04, 0x40, 0x81, 0x40, 0x09, 0x0f,
+    0x0f, 0x03, 0xf9, 0x80, 0x00, 0x89, 0x40, 0x0f, 0x08, 0x89, 0x40, 0x00,
+    0xf9, 0x80, 0x0f, 0x0f, 0x04, 0xf2, 0x05, 0x80, 0xb0, 0xf0, 0x80, 0x40,
+    0x04, 0x80, 0xf1, 0x80, 0x06, 0xf2, 0x05, 0x80, 0xb0, 0xf0, 0x80, 0x40,
+    0x04, 0x80, 0xf1, 0x80, 0x03, 0xf2, 0x03, 0x40, 0x80, 0xf0, 0xb0, 0x80,
+    0x03, 0x80, 0xf1, 0x80, 0x03, 0xf2, 0x05, 0x82, 0x0e, 0x00, 0x80, 0xf6,
+    0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf0, 0x80,
+    0x40, 0x06, 0xf2, 0x06, 0x80, 0xf1, 0x80, 0x07, 0x40, 0x81, 0x40, 0x0f,
+    0x03, 0x80, 0xf1, 0x80, 0x07, 0x40, 0x81, 0x40, 0x0f, 0x00, 0x80, 0xf6,
+    0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00,
+    0x40, 0x81, 0xb0, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf4, 0x80, 0x00,
+    0xf2, 0x00, 0x80, 0xf3, 0x02, 0xf2, 0x00, 0x40, 0x83, 0x02, 0xf2, 0x09,
+    0x80, 0xf7, 0x80, 0x01, 0x40, 0x87, 0x40, 0x0c, 0x02, 0xf3, 0x80, 0x04,
+    0x40, 0x80, 0xf0, 0xb0, 0x80, 0xf0, 0xb0, 0x80, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0xf2, 0x02, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf9, 0x80, 0x00,
+    0xf2, 0x83, 0xb0, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c,
+    0xf8, 0x02, 0x80, 0xb0, 0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40,
+    0x01, 0x80, 0xf6, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x00, 0xf8, 0x02, 0x88, 0x0e, 0x02, 0xf5, 0x03, 0x40,
+    0x80, 0xf0, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x08, 0xf2, 0x08, 0xf2, 0x08, 0xf2,
+    0x08, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x40, 0x81, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x03, 0xf5, 0x05, 0x85, 0x0e, 0xf6,
+    0x80, 0x03, 0x80, 0xb0, 0xf1, 0xb0, 0x80, 0xf0, 0xb0, 0x80, 0x03, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x00, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf6, 0x80, 0x03, 0x86, 0x40, 0x0f, 0xf9,
+    0x80, 0x00, 0xf2, 0x85, 0xf0, 0x80, 0x00, 0xf2, 0x05, 0xf0, 0x80, 0x00,
+    0xf2, 0x08, 0xf2, 0x83, 0x40, 0x03, 0xf6, 0x80, 0x03, 0xf2, 0x08, 0xf2,
+    0x05, 0x80, 0x40, 0x00, 0xf2, 0x05, 0xf0, 0x80, 0x00, 0xf9, 0x80, 0x00,
+    0x89, 0x40, 0x0c, 0xf9, 0x80, 0x00, 0x80, 0xb0, 0xf1, 0xb0, 0x83, 0xf0,
+    0x80, 0x01, 0x80, 0xf1, 0x80, 0x03, 0xf0, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x07, 0x80, 0xf1, 0xb0, 0x83, 0x03, 0x80, 0xf6, 0x03, 0x80, 0xf1, 0x80,
+    0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x06, 0xf5, 0x05, 0x85,
+    0x0f, 0x01, 0x00, 0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0,
+    0x80, 0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x08, 0xf2,
+    0x08, 0xf2, 0x08, 0xf2, 0x00, 0x80, 0xf4, 0x80, 0x00, 0xf2, 0x00, 0x40,
+    0x81, 0xb0, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80,
+    0xf6, 0x03, 0x40, 0x86, 0x0e, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x83, 0xb0, 0xf1, 0x80, 0x00, 0xf9,
+    0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0xf5, 0x01, 0x80, 0xb0,
+    0xf1, 0xb0, 0x80, 0x02, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03,
+    0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03,
+    0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x02, 0xf5, 0x01, 0x85, 0x09,
+    0x02, 0xf5, 0x04, 0x80, 0xb0, 0xf1, 0xb0, 0x80, 0x05, 0x80, 0xf1, 0x80,
+    0x06, 0x80, 0xf1, 0x80, 0x06, 0x80, 0xf1, 0x80, 0x06, 0x80, 0xf1, 0x80,
+    0x02, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x02, 0xf2, 0x00, 0x80, 0xf1, 0x80,
+    0x02, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xf3, 0x05, 0x40, 0x83,
+    0x0f, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0x80, 0xb0, 0xf0,
+    0x80, 0x40, 0x00, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x00, 0x80, 0xf1, 0x80,
+    0x03, 0xf2, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x03, 0xf5, 0x05, 0xf2, 0x00,
+    0x80, 0xf1, 0x80, 0x03, 0xf2, 0x00, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03,
+    0x40, 0x81, 0x40, 0x0c, 0xf5, 0x05, 0x80, 0xb0, 0xf1, 0xb0, 0x80, 0x06,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x03,
+    0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x03, 0xf0, 0x80, 0x00, 0xf9, 0x80,
+    0x00, 0x89, 0x40, 0x0c, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x80,
+    0x40, 0x00, 0x80, 0xb0, 0xf1, 0x80, 0x00, 0xf3, 0x80, 0x00, 0xf3, 0x80,
+    0x00, 0xf9, 0x80, 0x00, 0xf2, 0x80, 0xb0, 0xf0, 0x80, 0xb0, 0xf1, 0x80,
+    0x00, 0xf2, 0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00,
+    0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x40, 0x80, 0x00,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x00,
+    0xf3, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf3, 0x80, 0x01, 0x80, 0xf1,
+    0x80, 0x00, 0xf3, 0xb0, 0x80, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf5, 0x00,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf4, 0x80, 0x00, 0xf2, 0x00,
+    0x40, 0x80, 0xf3, 0x80, 0x00, 0xf2, 0x02, 0xf3, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0x00, 0x80,
+    0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0xf8,
+    0x02, 0x80, 0xb0, 0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80,
+    0xf1, 0x80, 0x01, 0x80, 0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01,
+    0x80, 0xf6, 0x03, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80,
+    0xf1, 0x80, 0x06, 0xf5, 0x05, 0x85, 0x0f, 0x01, 0x00, 0x80, 0xf6, 0x02,
+    0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x00, 0x40, 0x80, 0x00, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03,
+    0x40, 0x84, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80, 0x00, 0xf8,
+    0x02, 0xf2, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x83, 0xb0, 0xf0,
+    0x80, 0x40, 0x00, 0xf8, 0x02, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x03, 0xf2,
+    0x00, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0x00,
+    0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x08, 0x80, 0xb0, 0xf0, 0x85,
+    0x03, 0x80, 0xf6, 0x09, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40,
+    0x86, 0x0e, 0xf8, 0x01, 0xf0, 0xb0, 0x80, 0xf2, 0x80, 0xb0, 0xf0, 0x01,
+    0xf0, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf0, 0x04, 0xf2, 0x07, 0xf2, 0x07,
+    0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x05, 0x80, 0xf4, 0x80, 0x03,
+    0x40, 0x84, 0x40, 0x0d, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6,
+    0x03, 0x40, 0x86, 0x0e, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x40, 0x80,
+    0xf0, 0xb0, 0x80, 0xf0, 0xb0, 0x80, 0x05, 0xf3, 0x80, 0x07, 0x80, 0xf0,
+    0x09, 0x40, 0x80, 0x0f, 0x01, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf0,
+    0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1,
+    0x80, 0x00, 0xf9, 0x80, 0x00, 0xf3, 0xb0, 0x80, 0xf3, 0x80, 0x00, 0xf3,
+    0x80, 0x00, 0xf3, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x82,
+    0x03, 0x40, 0x81, 0x40, 0x0c, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x80,
+    0xb0, 0xf0, 0x80, 0x40, 0x00, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x05, 0xf3, 0x80, 0x06, 0xf3, 0x80, 0x06, 0xf3,
+    0x80, 0x06, 0xf3, 0x80, 0x04, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0xf0, 0xb0,
+    0x80, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0xf2, 0x02, 0xf2, 0x01,
+    0xf2, 0x02, 0xf2, 0x01, 0xf2, 0x02, 0xf2, 0x01, 0xf2, 0x02, 0xf2, 0x01,
+    0x80, 0xb0, 0xf0, 0x82, 0xf0, 0xb0, 0x80, 0x02, 0x80, 0xf4, 0x80, 0x05,
+    0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x05, 0x80, 0xf4, 0x80, 0x03, 0x40, 0x84,
+    0x40, 0x0d, 0xf9, 0x80, 0x00, 0xf0, 0xb0, 0x84, 0xb0, 0xf1, 0x80, 0x00,
+    0xf0, 0x80, 0x04, 0x80, 0xf1, 0x80, 0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0,
+    0xb0, 0x80, 0x06, 0x80, 0xf1, 0x80, 0x06, 0xf2, 0x06, 0x40, 0x80, 0xf0,
+    0xb0, 0x80, 0x02, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x03, 0xf0, 0x80,
+    0x00, 0xf9, 0x80, 0x00, 0x89, 0x40, 0x0c, 0xf6, 0x80, 0x00, 0xf2, 0x83,
+    0x40, 0x00, 0xf2, 0x05, 0xf2, 0x05, 0xf2, 0x05, 0xf2, 0x05, 0xf2, 0x05,
+    0xf2, 0x05, 0xf2, 0x05, 0xf6, 0x80, 0x00, 0x86, 0x40, 0x09, 0xf2, 0x08,
+    0x80, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80, 0x09, 0xf2, 0x08,
+    0x80, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80, 0x09, 0xf2, 0x08,
+    0x80, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80, 0x09, 0xf0, 0x80,
+    0x09, 0x80, 0x40, 0x0c, 0xf6, 0x80, 0x00, 0x83, 0xb0, 0xf1, 0x80, 0x04,
+    0x80, 0xf1, 0x80, 0x04, 0x80, 0xf1, 0x80, 0x04, 0x80, 0xf1, 0x80, 0x04,
+    0x80, 0xf1, 0x80, 0x04, 0x80, 0xf1, 0x80, 0x04, 0x80, 0xf1, 0x80, 0x04,
+    0x80, 0xf1, 0x80, 0x00, 0xf6, 0x80, 0x00, 0x86, 0x40, 0x09, 0x03, 0x80,
+    0xf0, 0x08, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x06, 0xf3, 0x80, 0x04, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x02, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0x80,
+    0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x0f, 0x0f,
+    0x0f, 0x0f, 0x08, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b,
+    0x8b, 0x01, 0xfb, 0x01, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x01, 0x40, 0x81, 0x40, 0x0f, 0x0f, 0x0a, 0x0f, 0x0f, 0x04, 0x80,
+    0xf4, 0x80, 0x04, 0x40, 0x83, 0xf0, 0xb0, 0x80, 0x08, 0xf2, 0x03, 0x80,
+    0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x82, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03,
+    0x80, 0xf7, 0x80, 0x01, 0x40, 0x87, 0x40, 0x0c, 0xf3, 0x80, 0x06, 0x80,
+    0xb0, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf6, 0x03, 0x80,
+    0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x00, 0xf8, 0x02, 0x88, 0x0e, 0x0f, 0x0f, 0x04, 0x80,
+    0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x08, 0xf2, 0x03, 0x40, 0x81, 0x40,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf6, 0x03, 0x40, 0x86,
+    0x0e, 0x03, 0x80, 0xf3, 0x06, 0x40, 0x80, 0xf2, 0x08, 0xf2, 0x03, 0x80,
+    0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x82, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03,
+    0x80, 0xf7, 0x80, 0x01, 0x40, 0x87, 0x40, 0x0c, 0x0f, 0x0f, 0x04, 0x80,
+    0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf9, 0x80, 0x00, 0xf2, 0x86, 0x40, 0x00,
+    0xf2, 0x09, 0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0x03, 0x80, 0xf3, 0x05,
+    0x80, 0xb0, 0xf0, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x03, 0xf2, 0x00, 0x80,
+    0xf1, 0x80, 0x03, 0xf2, 0x05, 0x82, 0xf2, 0x82, 0x02, 0xf8, 0x05, 0xf2,
+    0x08, 0xf2, 0x08, 0xf2, 0x06, 0x80, 0xf4, 0x80, 0x04, 0x40, 0x84, 0x40,
+    0x0f, 0x0f, 0x0f, 0x04, 0x80, 0xf3, 0x00, 0x80, 0xf1, 0x80, 0x00, 0x80,
+    0xb0, 0xf0, 0x83, 0xb0, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf3, 0x80, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf1,
+    0x80, 0x01, 0x80, 0xf7, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x01, 0x40, 0x84,
+    0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf6, 0x02, 0xf3, 0x80, 0x06, 0x80,
+    0xb0, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf6, 0x03, 0x80,
+    0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x00, 0xf3, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0x83,
+    0x40, 0x01, 0x40, 0x81, 0x40, 0x0c, 0x00, 0x80, 0xf1, 0x80, 0x03, 0x40,
+    0x81, 0x40, 0x0a, 0xf3, 0x80, 0x02, 0x80, 0xb0, 0xf1, 0x80, 0x03, 0x80,
+    0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x03, 0x80,
+    0xf1, 0x80, 0x02, 0xf5, 0x01, 0x85, 0x09, 0x05, 0xf2, 0x07, 0x82, 0x0f,
+    0x00, 0x80, 0xf3, 0x05, 0x40, 0x80, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x07,
+    0xf2, 0x07, 0xf2, 0x01, 0xf2, 0x02, 0xf2, 0x01, 0x80, 0xb0, 0xf0, 0x82,
+    0xf0, 0xb0, 0x80, 0x02, 0x80, 0xf4, 0x80, 0x02, 0xf3, 0x80, 0x06, 0x80,
+    0xb0, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0x80, 0xb0, 0xf0, 0x80,
+    0x40, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf4, 0x80, 0x04,
+    0x80, 0xf1, 0xb0, 0x80, 0xf0, 0xb0, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x02, 0xf3, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0x83, 0x40, 0x01,
+    0x40, 0x81, 0x40, 0x0c, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf3, 0x80,
+    0x00, 0x83, 0x40, 0x06, 0x0f, 0x0f, 0x04, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x02, 0x80, 0xb0, 0xf1, 0xb0, 0x80, 0xf2, 0x80, 0x40, 0x00, 0xf9, 0x80,
+    0x00, 0xf2, 0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00,
+    0x80, 0xf0, 0x00, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf0, 0x00,
+    0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03,
+    0x40, 0x81, 0x40, 0x0c, 0x0f, 0x0f, 0x03, 0xf2, 0x00, 0x80, 0xf3, 0x02,
+    0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80,
+    0x01, 0x40, 0x81, 0x40, 0x01, 0x40, 0x81, 0x40, 0x0c, 0x0f, 0x0f, 0x04,
+    0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00,
+    0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0x0f, 0x0f, 0x03, 0xf2, 0x00, 0x80,
+    0xf3, 0x02, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x01, 0x80,
+    0xf1, 0x80, 0x01, 0x80, 0xf1, 0xb0, 0x81, 0xb0, 0xf0, 0x80, 0x40, 0x01,
+    0x80, 0xf6, 0x03, 0x80, 0xf1, 0x80, 0x06, 0x80, 0xb0, 0xf1, 0xb0, 0x80,
+    0x05, 0xf5, 0x05, 0x0f, 0x0f, 0x04, 0x80, 0xf3, 0x00, 0x80, 0xf1, 0x80,
+    0x00, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0x80, 0xb0, 0xf0, 0x82, 0xf2, 0x03,
+    0x80, 0xf6, 0x08, 0xf2, 0x06, 0x40, 0x80, 0xf2, 0x80, 0x40, 0x04, 0x80,
+    0xf4, 0x80, 0x00, 0x0f, 0x0f, 0x03, 0xf2, 0x00, 0x80, 0xf3, 0x02, 0x80,
+    0xb0, 0xf0, 0x83, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x07,
+    0x80, 0xf1, 0x80, 0x06, 0xf5, 0x05, 0x85, 0x0f, 0x01, 0x0f, 0x0f, 0x04,
+    0x80, 0xf6, 0x02, 0x80, 0xb0, 0xf0, 0x85, 0x02, 0xf2, 0x09, 0x80, 0xf6,
+    0x03, 0x40, 0x84, 0xb0, 0xf0, 0x80, 0x40, 0x07, 0x80, 0xf1, 0x80, 0x01,
+    0x80, 0xf6, 0x03, 0x40, 0x86, 0x0e, 0x02, 0xf2, 0x08, 0xf2, 0x08, 0xf2,
+    0x05, 0xf8, 0x02, 0x82, 0xf2, 0x82, 0x05, 0xf2, 0x08, 0xf2, 0x08, 0xf2,
+    0x00, 0x40, 0x81, 0x40, 0x03, 0xf2, 0x00, 0x80, 0xf1, 0x80, 0x04, 0x80,
+    0xf3, 0x06, 0x40, 0x83, 0x0e, 0x0f, 0x0f, 0x03, 0xf2, 0x02, 0xf2, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02,
+    0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x02, 0xf2, 0x03, 0x80, 0xf3, 0x00, 0x80,
+    0xf1, 0x80, 0x01, 0x40, 0x83, 0x00, 0x40, 0x81, 0x40, 0x0c, 0x0f, 0x0f,
+    0x03, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80,
+    0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0xf0, 0xb0, 0x80, 0x05, 0xf3, 0x80,
+    0x07, 0x80, 0xf0, 0x09, 0x40, 0x80, 0x0f, 0x01, 0x0f, 0x0f, 0x03, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x00, 0x80, 0xf0, 0x00, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x80, 0xb0, 0xf0, 0x80, 0xb0, 0xf1, 0x80, 0x00, 0xf9,
+    0x80, 0x01, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x40, 0x81, 0x40, 0x00,
+    0x82, 0x0e, 0x0f, 0x0f, 0x03, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0x80,
+    0xb0, 0xf0, 0x80, 0x40, 0x00, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x01, 0x80,
+    0xf1, 0x80, 0x00, 0xf2, 0x05, 0xf3, 0x80, 0x04, 0x40, 0x80, 0xf0, 0xb0,
+    0x80, 0xf0, 0xb0, 0x80, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf2,
+    0x03, 0x80, 0xf1, 0x80, 0x00, 0x82, 0x03, 0x40, 0x81, 0x40, 0x0c, 0x0f,
+    0x0f, 0x03, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1,
+    0x80, 0x00, 0xf2, 0x03, 0x80, 0xf1, 0x80, 0x00, 0xf2, 0x02, 0xf3, 0x80,
+    0x00, 0x80, 0xb0, 0xf0, 0x83, 0xb0, 0xf1, 0x80, 0x01, 0x80, 0xf3, 0x00,
+    0x80, 0xf1, 0x80, 0x07, 0x80, 0xf1, 0x80, 0x01, 0x40, 0x84, 0xb0, 0xf0,
+    0x80, 0x40, 0x01, 0x80, 0xf6, 0x02, 0x0f, 0x0f, 0x00, 0xf8, 0x01, 0xf0,
+    0xb0, 0x81, 0xb0, 0xf1, 0xb0, 0x80, 0x01, 0xf0, 0x80, 0x01, 0x80, 0xf1,
+    0x80, 0x05, 0xf2, 0x05, 0x40, 0x80, 0xf0, 0xb0, 0x80, 0x00, 0x40, 0x80,
+    0x02, 0x80, 0xf1, 0x80, 0x01, 0x80, 0xf0, 0x01, 0xf8, 0x01, 0x88, 0x0c,
+    0x03, 0x80, 0xf3, 0x04, 0x80, 0xb0, 0xf0, 0x82, 0x04, 0xf2, 0x07, 0xf2,
+    0x04, 0x82, 0xf0, 0xb0, 0x80, 0x04, 0xf3, 0x80, 0x08, 0xf2, 0x07, 0xf2,
+    0x07, 0xf2, 0x08, 0x80, 0xf3, 0x05, 0x40, 0x83, 0x0c, 0xf2, 0x01, 0xf2,
+    0x01, 0xf2, 0x01, 0xf2, 0x01, 0x82, 0x06, 0xf2, 0x01, 0xf2, 0x01, 0xf2,
+    0x01, 0xf2, 0x01, 0x82, 0x06, 0xf3, 0x80, 0x05, 0x82, 0xf0, 0xb0, 0x80,
+    0x07, 0xf2, 0x07, 0xf2, 0x07, 0x80, 0xb0, 0xf0, 0x82, 0x05, 0x80, 0xf3,
+    0x04, 0xf2, 0x07, 0xf2, 0x07, 0xf2, 0x04, 0xf3, 0x80, 0x05, 0x83, 0x40,
+    0x0f, 0x00, 0x00, 0x80, 0xf3, 0x00, 0x80, 0xf1, 0x80, 0x00, 0x80, 0xb0,
+    0xf0, 0x80, 0xb0, 0xf0, 0x80, 0xb0, 0xf0, 0x80, 0x40, 0x00, 0xf2, 0x00,
+    0x80, 0xf3, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e,
+};
+
+static const struct FontGlyph Font_Prop12_glyphs[95] = {
+    {     0,  5 },   /*  32   */
+    {     4,  8 },   /*  33 ! */
+    {    45,  9 },   /*  34 " */
+    {    78, 12 },   /*  35 # */
+    {   145, 12 },   /*  36 $ */
+    {   192, 12 },   /*  37 % */
+    {   241, 12 },   /*  38 & */
+    {   302,  6 },   /*  39 ' */
+    {   321,  8 },   /*  40 ( */
+    {   356,  8 },   /*  41 ) */
+    {   390, 12 },   /*  42 * */
+    {   435, 11 },   /*  43 + */
+    {   456,  6 },   /*  44 , */
+    {   475, 12 },   /*  45 - */
+    {   488,  6 },   /*  46 . */
+    {   503, 12 },   /*  47 / */
+    {   547, 12 },   /*  48 0 */
+    {   611, 11 },   /*  49 1 */
+    {   635, 12 },   /*  50 2 */
+    {   692, 12 },   /*  51 3 */
+    {   745, 12 },   /*  52 4 */
+    {   784, 12 },   /*  53 5 */
+    {   827, 12 },   /*  54 6 */
+    {   877, 12 },   /*  55 7 */
+    {   924, 12 },   /*  56 8 */
+    {   985, 12 },   /*  57 9 */
+    {  1044,  6 },   /*  58 : */
+    {  1069,  6 },   /*  59 ; */
+    {  1106,  9 },   /*  60 < */
+    {  1151, 12 },   /*  61 = */
+    {  1169,  9 },   /*  62 > */
+    {  1209, 12 },   /*  63 ? */
+    {  1257, 12 },   /*  64 @ */
+    {  1316, 12 },   /*  65 A */
+    {  1380, 12 },   /*  66 B */
+    {  1448, 12 },   /*  67 C */
+    {  1499, 12 },   /*  68 D */
+    {  1571, 12 },   /*  69 E */
+    {  1611, 12 },   /*  70 F */
+    {  1658, 12 },   /*  71 G */
+    {  1709, 12 },   /*  72 H */
+    {  1772,  8 },   /*  73 I */
+    {  1812, 11 },   /*  74 J */
+    {  1861, 12 },   /*  75 K */
+    {  1924, 12 },   /*  76 L */
+    {  1972, 12 },   /*  77 M */
+    {  2050, 12 },   /*  78 N */
+    {  2122, 12 },   /*  79 O */
+    {  2183, 12 },   /*  80 P */
+    {  2240, 12 },   /*  81 Q */
+    {  2315, 12 },   /*  82 R */
+    {  2375, 12 },   /*  83 S */
+    {  2426, 11 },   /*  84 T */
+    {  2464, 12 },   /*  85 U */
+    {  2524, 12 },   /*  86 V */
+    {  2585, 12 },   /*  87 W */
+    {  2657, 12 },   /*  88 X */
+    {  2720, 11 },   /*  89 Y */
+    {  2762, 12 },   /*  90 Z */
+    {  2815,  9 },   /*  91 [ */
+    {  2842, 12 },   /*  92   */
+    {  2884,  9 },   /*  93 ] */
+    {  2926, 12 },   /*  94 ^ */
+    {  2967, 14 },   /*  95 _ */
+    {  2980,  6 },   /*  96 ` */
+    {  2996, 12 },   /*  97 a */
+    {  3032, 12 },   /*  98 b */
+    {  3092, 12 },   /*  99 c */
+    {  3133, 12 },   /* 100 d */
+    {  3176, 12 },   /* 101 e */
+    {  3212, 12 },   /* 102 f */
+    {  3253, 12 },   /* 103 g */
+    {  3308, 12 },   /* 104 h */
+    {  3378,  8 },   /* 105 i */
+    {  3415, 11 },   /* 106 j */
+    {  3452, 12 },   /* 107 k */
+    {  3520,  6 },   /* 108 l */
+    {  3544, 12 },   /* 109 m */
+    {  3604, 12 },   /* 110 n */
+    {  3669, 12 },   /* 111 o */
+    {  3714, 12 },   /* 112 p */
+    {  3771, 12 },   /* 113 q */
+    {  3819, 12 },   /* 114 r */
+    {  3861, 12 },   /* 115 s */
+    {  3894, 12 },   /* 116 t */
+    {  3929, 12 },   /* 117 u */
+    {  3970, 12 },   /* 118 v */
+    {  4016, 12 },   /* 119 w */
+    {  4070, 12 },   /* 120 x */
+    {  4127, 12 },   /* 121 y */
+    {  4182, 11 },   /* 122 z */
+    {  4224, 11 },   /* 123 { */
+    {  4257,  5 },   /* 124 | */
+    {  4277, 11 },   /* 125 } */
+    {  4310, 12 },   /* 126 ~ */
+};
+
+const struct Font Font_Prop12 = {
+    12, 32, 95, FONT_RLE, 4, Font_Prop12_glyphs, Font_Prop12_bits
+};
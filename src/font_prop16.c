@@ -0,0 +1,342 @@
+/*
+ * Description:
+ *
+ * Font Font_Prop16, 16 rows, characters 32 to 126, 1 bit per pixel, packed.
+ * Generated by tools/bdf2font, do not edit.
+ */
+#include "font.h"
+
+static const uint8_t Font_Prop16_bits[2756] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3c, 0x0f, 0x0f, 0xf3, 0xfc, 0xff, 0x3f, 0xc3, 0xc0, 0xf0, 0x3c, 0x0f,
+    0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0xf3, 0xcf, 0x3c, 0xf3,
+    0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x3c, 0xf0, 0x3c, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0x3c, 0xf0, 0x3c, 0xf0,
+    0xff, 0xfc, 0xff, 0xfc, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0, 0x3f, 0xfc, 0x3f, 0xfc,
+    0xf0, 0x00, 0xf0, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
+    0xff, 0xf0, 0xff, 0xf0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
+    0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x0f, 0xc0,
+    0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0, 0x3f, 0x3c, 0x3f, 0x3c,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x3f, 0x3c, 0x3f, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x03, 0xc3, 0xc0,
+    0xf0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0x3c, 0x03, 0xc0, 0xf0, 0x0f,
+    0x03, 0xc0, 0x00, 0x00, 0xf0, 0x3c, 0x03, 0xc0, 0xf0, 0x0f, 0x03, 0xc0,
+    0xf0, 0x3c, 0x0f, 0x03, 0xc3, 0xc0, 0xf0, 0xf0, 0x3c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xff, 0xfc, 0xff, 0xfc, 0x3f, 0xf0, 0x3f, 0xf0, 0xfc, 0xfc, 0xfc, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0x0f, 0xff, 0x3f, 0xfc, 0x0f, 0x00,
+    0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc,
+    0xfc, 0xfc, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
+    0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0xfc, 0xf0, 0xfc,
+    0xf3, 0xfc, 0xf3, 0xfc, 0xff, 0x3c, 0xff, 0x3c, 0xfc, 0x3c, 0xfc, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x3c, 0x0f,
+    0xf0, 0x3f, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00,
+    0x3c, 0x00, 0xf0, 0x03, 0xc0, 0xff, 0xf3, 0xff, 0xc0, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
+    0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0,
+    0x00, 0x3c, 0x00, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0xf0, 0x03, 0xf0,
+    0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0xff, 0xfc, 0xff, 0xfc,
+    0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xfc, 0x3f, 0xfc,
+    0x00, 0x3c, 0x00, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00,
+    0x00, 0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0xf0,
+    0x03, 0xc0, 0x3c, 0x0f, 0x00, 0xf0, 0x3c, 0x03, 0xc0, 0xf0, 0x0f, 0x00,
+    0x3c, 0x03, 0xc0, 0x0f, 0x00, 0xf0, 0x03, 0xc0, 0x3c, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x3c,
+    0x03, 0xc0, 0x0f, 0x00, 0xf0, 0x03, 0xc0, 0x3c, 0x0f, 0x00, 0xf0, 0x3c,
+    0x03, 0xc0, 0xf0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xf0,
+    0x03, 0xc0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x03, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf3, 0xfc, 0xf3, 0xfc, 0xf3, 0xf0, 0xf3, 0xf0,
+    0xf0, 0x00, 0xf0, 0x00, 0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xff, 0xf0, 0xff, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xc0, 0xff, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+    0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+    0xf0, 0x0c, 0xf0, 0x0c, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xc0, 0xff, 0xc0,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x0c, 0xf0, 0x0c, 0xff, 0xfc, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc, 0x3c, 0x0c, 0x3c, 0x0c,
+    0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xf3, 0xfc, 0xf3, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0xc3, 0xc0, 0xf0, 0x3c, 0x0f, 0x03,
+    0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0xff, 0x3f, 0xc0, 0x00, 0x00,
+    0x0f, 0xf0, 0x3f, 0xc0, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c,
+    0x00, 0xf0, 0xf3, 0xc3, 0xcf, 0x0f, 0x3c, 0x3c, 0xf0, 0x3f, 0x00, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf3, 0xc0, 0xf3, 0xc0, 0xff, 0x00, 0xff, 0x00, 0xf3, 0xc0, 0xf3, 0xc0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x0c, 0x3c, 0x0c,
+    0xff, 0xfc, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xfc, 0xfc, 0xfc, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0x3c, 0xf3, 0x3c,
+    0xf3, 0x3c, 0xf3, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0xfc, 0x3c, 0xfc, 0x3c,
+    0xfc, 0x3c, 0xfc, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf3, 0xfc, 0xf3, 0xfc,
+    0xf0, 0xfc, 0xf0, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf3, 0x3c, 0xf3, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x3c, 0x00, 0x3c,
+    0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xff, 0xf0, 0xff, 0xf0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x3c, 0x00, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xcc, 0xf3, 0x33, 0xcc, 0x0f,
+    0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03,
+    0xc0, 0x3f, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf3, 0x3c, 0xf3, 0x3c,
+    0xf3, 0x3c, 0xf3, 0x3c, 0xff, 0xfc, 0xff, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x3c, 0xf0, 0x3c, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0, 0x0f, 0xc0, 0x0f, 0xc0,
+    0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf3, 0xc3, 0xcf, 0x0f, 0x3c, 0x3c, 0xf0,
+    0xf3, 0xc3, 0xc3, 0xfc, 0x0f, 0xf0, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03,
+    0xc0, 0x3f, 0xc0, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xff, 0xfc,
+    0xc0, 0x3c, 0xc0, 0x3c, 0x00, 0xf0, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0xc0,
+    0x0f, 0x00, 0x0f, 0x00, 0x3c, 0x0c, 0x3c, 0x0c, 0xff, 0xfc, 0xff, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xcf, 0xfc, 0xf0, 0x0f, 0x00, 0xf0, 0x0f,
+    0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xf0, 0x0f, 0x00, 0xff, 0xcf,
+    0xfc, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x0f, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x03, 0xc0, 0x00, 0xf0, 0x00, 0xf0,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xcf, 0xfc, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c,
+    0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0xff, 0xcf, 0xfc, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x03, 0x00, 0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xf3, 0xff, 0xfc, 0xf0, 0xf0, 0xf0, 0xf0,
+    0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x00, 0xf0, 0x00, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xff, 0xf0, 0xff, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xf0, 0x03, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0x3f, 0xfc, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x00, 0xf0, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x03, 0xf0, 0x0f, 0x3c, 0x0f, 0x3c,
+    0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00,
+    0x0f, 0x00, 0x0f, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+    0xf0, 0xfc, 0xf0, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xfc, 0x3f, 0xfc,
+    0x00, 0x3c, 0x00, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0, 0xfc, 0x00, 0xfc, 0x00,
+    0x3c, 0x00, 0x3c, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0x3c, 0xfc, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x03,
+    0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0xc0, 0xf0, 0xff, 0x3f, 0xc0, 0x00, 0x00,
+    0x00, 0xf0, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0xc0, 0x0f,
+    0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0xf0, 0xf3, 0xc3,
+    0xc3, 0xfc, 0x0f, 0xf0, 0xfc, 0x00, 0xfc, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0, 0x3f, 0xc0, 0x3f, 0xc0,
+    0x3c, 0xf0, 0x3c, 0xf0, 0xfc, 0x3c, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3c, 0xf0, 0x3c, 0xf0, 0xff, 0xfc, 0xff, 0xfc, 0xf3, 0x3c, 0xf3, 0x3c,
+    0xf3, 0x3c, 0xf3, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xf0, 0xf3, 0xf0,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf3, 0xf0, 0xf3, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3f, 0xf0, 0x3f, 0xf0, 0x3c, 0x00, 0x3c, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3c, 0x3f, 0x3c,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0xf0, 0x00, 0xf0, 0x03, 0xfc, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf3, 0xf0, 0xf3, 0xf0, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xf0, 0x3f, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x3c, 0x00, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0xff, 0xf0, 0xff, 0xf0,
+    0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x3c, 0x0f, 0x3c,
+    0x03, 0xf0, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x3f, 0x3c, 0x3f, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x0f, 0xc0, 0x0f, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf3, 0x3c, 0xf3, 0x3c, 0xff, 0xfc, 0xff, 0xfc,
+    0x3c, 0xf0, 0x3c, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x0f, 0xc0, 0x0f, 0xc0, 0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0x3c, 0xf0, 0x3c,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0xfc, 0xf0, 0xfc,
+    0x3f, 0x3c, 0x3f, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x3f, 0xf0, 0x3f, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf3, 0xff, 0xcc, 0x3c,
+    0x30, 0xf0, 0x0f, 0x00, 0x3c, 0x03, 0xc3, 0x0f, 0x0c, 0xff, 0xf3, 0xff,
+    0xc0, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0xc0, 0xf0, 0x03, 0xc0, 0x0f,
+    0x00, 0x3c, 0x0f, 0xc0, 0x3f, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03,
+    0xc0, 0x03, 0xf0, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0xf3, 0xcf, 0x3c, 0xf3,
+    0xc0, 0x00, 0xf3, 0xcf, 0x3c, 0xf3, 0xc0, 0x00, 0xfc, 0x03, 0xf0, 0x00,
+    0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c, 0x00, 0x3f, 0x00, 0xfc, 0x0f, 0x00,
+    0x3c, 0x00, 0xf0, 0x03, 0xc0, 0xfc, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0x3c, 0x3f, 0x3c, 0xf3, 0xf0, 0xf3, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct FontGlyph Font_Prop16_glyphs[95] = {
+    {     0,  6 },   /*  32   */
+    {    12, 10 },   /*  33 ! */
+    {    32, 12 },   /*  34 " */
+    {    56, 16 },   /*  35 # */
+    {    88, 16 },   /*  36 $ */
+    {   120, 16 },   /*  37 % */
+    {   152, 16 },   /*  38 & */
+    {   184,  8 },   /*  39 ' */
+    {   200, 10 },   /*  40 ( */
+    {   220, 10 },   /*  41 ) */
+    {   240, 16 },   /*  42 * */
+    {   272, 14 },   /*  43 + */
+    {   300,  8 },   /*  44 , */
+    {   316, 16 },   /*  45 - */
+    {   348,  8 },   /*  46 . */
+    {   364, 16 },   /*  47 / */
+    {   396, 16 },   /*  48 0 */
+    {   428, 14 },   /*  49 1 */
+    {   456, 16 },   /*  50 2 */
+    {   488, 16 },   /*  51 3 */
+    {   520, 16 },   /*  52 4 */
+    {   552, 16 },   /*  53 5 */
+    {   584, 16 },   /*  54 6 */
+    {   616, 16 },   /*  55 7 */
+    {   648, 16 },   /*  56 8 */
+    {   680, 16 },   /*  57 9 */
+    {   712,  8 },   /*  58 : */
+    {   728,  8 },   /*  59 ; */
+    {   744, 12 },   /*  60 < */
+    {   768, 16 },   /*  61 = */
+    {   800, 12 },   /*  62 > */
+    {   824, 16 },   /*  63 ? */
+    {   856, 16 },   /*  64 @ */
+    {   888, 16 },   /*  65 A */
+    {   920, 16 },   /*  66 B */
+    {   952, 16 },   /*  67 C */
+    {   984, 16 },   /*  68 D */
+    {  1016, 16 },   /*  69 E */
+    {  1048, 16 },   /*  70 F */
+    {  1080, 16 },   /*  71 G */
+    {  1112, 16 },   /*  72 H */
+    {  1144, 10 },   /*  73 I */
+    {  1164, 14 },   /*  74 J */
+    {  1192, 16 },   /*  75 K */
+    {  1224, 16 },   /*  76 L */
+    {  1256, 16 },   /*  77 M */
+    {  1288, 16 },   /*  78 N */
+    {  1320, 16 },   /*  79 O */
+    {  1352, 16 },   /*  80 P */
+    {  1384, 16 },   /*  81 Q */
+    {  1416, 16 },   /*  82 R */
+    {  1448, 16 },   /*  83 S */
+    {  1480, 14 },   /*  84 T */
+    {  1508, 16 },   /*  85 U */
+    {  1540, 16 },   /*  86 V */
+    {  1572, 16 },   /*  87 W */
+    {  1604, 16 },   /*  88 X */
+    {  1636, 14 },   /*  89 Y */
+    {  1664, 16 },   /*  90 Z */
+    {  1696, 12 },   /*  91 [ */
+    {  1720, 16 },   /*  92   */
+    {  1752, 12 },   /*  93 ] */
+    {  1776, 16 },   /*  94 ^ */
+    {  1808, 18 },   /*  95 _ */
+    {  1844,  8 },   /*  96 ` */
+    {  1860, 16 },   /*  97 a */
+    {  1892, 16 },   /*  98 b */
+    {  1924, 16 },   /*  99 c */
+    {  1956, 16 },   /* 100 d */
+    {  1988, 16 },   /* 101 e */
+    {  2020, 16 },   /* 102 f */
+    {  2052, 16 },   /* 103 g */
+    {  2084, 16 },   /* 104 h */
+    {  2116, 10 },   /* 105 i */
+    {  2136, 14 },   /* 106 j */
+    {  2164, 16 },   /* 107 k */
+    {  2196,  8 },   /* 108 l */
+    {  2212, 16 },   /* 109 m */
+    {  2244, 16 },   /* 110 n */
+    {  2276, 16 },   /* 111 o */
+    {  2308, 16 },   /* 112 p */
+    {  2340, 16 },   /* 113 q */
+    {  2372, 16 },   /* 114 r */
+    {  2404, 16 },   /* 115 s */
+    {  2436, 16 },   /* 116 t */
+    {  2468, 16 },   /* 117 u */
+    {  2500, 16 },   /* 118 v */
+    {  2532, 16 },   /* 119 w */
+    {  2564, 16 },   /* 120 x */
+    {  2596, 16 },   /* 121 y */
+    {  2628, 14 },   /* 122 z */
+    {  2656, 14 },   /* 123 { */
+    {  2684,  6 },   /* 124 | */
+    {  2696, 14 },   /* 125 } */
+    {  2724, 16 },   /* 126 ~ */
+};
+
+const struct Font Font_Prop16 = {
+    16, 32, 95, FONT_PACKED, 1, Font_Prop16_glyphs, Font_Prop16_bits
+};
@@ -0,0 +1,170 @@
+/*
+ * Description:
+ *
+ * Font Font_Prop8, 8 rows, characters 32 to 126, 1 bit per pixel, packed.
+ * Generated by tools/bdf2font, do not edit.
+ */
+#include "font.h"
+
+static const uint8_t Font_Prop8_bits[689] = {
+    0x00, 0x00, 0x00, 0x67, 0xbc, 0xc6, 0x01, 0x80, 0xdb, 0x6d, 0x80, 0x00,
+    0x00, 0x00, 0x6c, 0x6c, 0xfe, 0x6c, 0xfe, 0x6c, 0x6c, 0x00, 0x18, 0x7e,
+    0xc0, 0x7c, 0x06, 0xfc, 0x18, 0x00, 0x00, 0xc6, 0x0c, 0x18, 0x30, 0x60,
+    0xc6, 0x00, 0x38, 0x6c, 0x38, 0x76, 0xcc, 0xcc, 0x76, 0x00, 0x66, 0xc0,
+    0x00, 0x00, 0x33, 0x31, 0x8c, 0x30, 0xc0, 0xc3, 0x0c, 0x63, 0x33, 0x00,
+    0x00, 0xee, 0x7c, 0xfe, 0x7c, 0xee, 0x00, 0x00, 0x00, 0x60, 0xc7, 0xe3,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x66, 0xc0, 0x00, 0x00, 0x00, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe0, 0x06, 0x0c, 0x18, 0x30, 0x60,
+    0xc0, 0x80, 0x00, 0x7c, 0xc6, 0xce, 0xde, 0xf6, 0xe6, 0x7c, 0x00, 0x31,
+    0xe0, 0xc1, 0x83, 0x06, 0x3f, 0x00, 0x7c, 0xc6, 0x0c, 0x18, 0x30, 0x66,
+    0xfe, 0x00, 0x7c, 0xc6, 0x06, 0x3c, 0x06, 0xc6, 0x7c, 0x00, 0x0c, 0x1c,
+    0x3c, 0x6c, 0xfe, 0x0c, 0x0c, 0x00, 0xfe, 0xc0, 0xfc, 0x06, 0x06, 0xc6,
+    0x7c, 0x00, 0x7c, 0xc6, 0xc0, 0xfc, 0xc6, 0xc6, 0x7c, 0x00, 0xfe, 0xc6,
+    0x06, 0x0c, 0x18, 0x18, 0x18, 0x00, 0x7c, 0xc6, 0xc6, 0x7c, 0xc6, 0xc6,
+    0x7c, 0x00, 0x7c, 0xc6, 0xc6, 0x7e, 0x06, 0xc6, 0x7c, 0x00, 0x0e, 0xe0,
+    0x0e, 0xe0, 0x06, 0x60, 0x06, 0x6c, 0x18, 0xc6, 0x30, 0x60, 0xc1, 0x80,
+    0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xc1, 0x83, 0x06, 0x31,
+    0x8c, 0x00, 0x7c, 0xc6, 0x06, 0x0c, 0x18, 0x00, 0x18, 0x00, 0x7c, 0xc6,
+    0xc6, 0xde, 0xdc, 0xc0, 0x7e, 0x00, 0x38, 0x6c, 0xc6, 0xc6, 0xfe, 0xc6,
+    0xc6, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x66, 0x66, 0xfc, 0x00, 0x3c, 0x66,
+    0xc0, 0xc0, 0xc0, 0x66, 0x3c, 0x00, 0xf8, 0x6c, 0x66, 0x66, 0x66, 0x6c,
+    0xf8, 0x00, 0xfe, 0xc2, 0xc0, 0xf8, 0xc0, 0xc2, 0xfe, 0x00, 0xfe, 0x62,
+    0x60, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x7c, 0xc6, 0xc0, 0xc0, 0xde, 0xc6,
+    0x7c, 0x00, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0x00, 0xf3, 0x18,
+    0xc6, 0x33, 0xc0, 0x3c, 0x30, 0x60, 0xcd, 0x9b, 0x1c, 0x00, 0xc6, 0xcc,
+    0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x62,
+    0xfe, 0x00, 0xc6, 0xee, 0xfe, 0xd6, 0xd6, 0xc6, 0xc6, 0x00, 0xc6, 0xe6,
+    0xe6, 0xf6, 0xde, 0xce, 0xc6, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6,
+    0x7c, 0x00, 0xfc, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00, 0x7c, 0xc6,
+    0xc6, 0xc6, 0xc6, 0xd6, 0x7c, 0x06, 0xfc, 0xc6, 0xc6, 0xfc, 0xd8, 0xcc,
+    0xc6, 0x00, 0x7c, 0xc6, 0xc0, 0x7c, 0x06, 0xc6, 0x7c, 0x00, 0xfd, 0x68,
+    0xc1, 0x83, 0x06, 0x1e, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c,
+    0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38, 0x10, 0x00, 0xc6, 0xc6, 0xd6,
+    0xd6, 0xfe, 0xee, 0xc6, 0x00, 0xc6, 0x6c, 0x38, 0x38, 0x38, 0x6c, 0xc6,
+    0x00, 0xcd, 0x9b, 0x33, 0xc3, 0x06, 0x1e, 0x00, 0xfe, 0x86, 0x0c, 0x18,
+    0x30, 0x62, 0xfe, 0x00, 0xfb, 0x0c, 0x30, 0xc3, 0x0f, 0x80, 0xc0, 0x60,
+    0x30, 0x18, 0x0c, 0x06, 0x02, 0x00, 0xf8, 0x61, 0x86, 0x18, 0x6f, 0x80,
+    0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xfe, 0xcc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x78,
+    0x0c, 0x7c, 0xcc, 0x7e, 0x00, 0xe0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0xfc,
+    0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc0, 0xc6, 0x7c, 0x00, 0x1c, 0x0c, 0x7c,
+    0xcc, 0xcc, 0xcc, 0x7e, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0x7c,
+    0x00, 0x1c, 0x36, 0x30, 0xfc, 0x30, 0x30, 0x78, 0x00, 0x00, 0x00, 0x76,
+    0xce, 0xc6, 0x7e, 0x06, 0x7c, 0xe0, 0x60, 0x7c, 0x66, 0x66, 0x66, 0xe6,
+    0x00, 0x60, 0x38, 0xc6, 0x33, 0xc0, 0x0c, 0x00, 0x70, 0x60, 0xc1, 0xb3,
+    0x3c, 0xe0, 0x60, 0x66, 0x6c, 0x78, 0x6c, 0xe6, 0x00, 0xcc, 0xcc, 0xcc,
+    0xe0, 0x00, 0x00, 0x6c, 0xfe, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0xdc,
+    0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0x7c,
+    0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x7c, 0x60, 0xf0, 0x00, 0x00, 0x76,
+    0xcc, 0xcc, 0x7c, 0x0c, 0x1e, 0x00, 0x00, 0xdc, 0x66, 0x60, 0x60, 0xf0,
+    0x00, 0x00, 0x00, 0x7c, 0xc0, 0x7c, 0x06, 0x7c, 0x00, 0x30, 0x30, 0xfc,
+    0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0x76,
+    0x00, 0x00, 0x00, 0xc6, 0xc6, 0x6c, 0x38, 0x10, 0x00, 0x00, 0x00, 0xc6,
+    0xc6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x6c, 0xc6,
+    0x00, 0x00, 0x00, 0xc6, 0xc6, 0xce, 0x76, 0x06, 0x7c, 0x00, 0x03, 0xf4,
+    0xc3, 0x0c, 0xbf, 0x00, 0x1c, 0x60, 0xc7, 0x03, 0x06, 0x07, 0x00, 0xdb,
+    0x0d, 0xb0, 0xe0, 0x60, 0xc0, 0xe3, 0x06, 0x38, 0x00, 0x76, 0xdc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const struct FontGlyph Font_Prop8_glyphs[95] = {
+    {     0,  3 },   /*  32   */
+    {     3,  5 },   /*  33 ! */
+    {     8,  6 },   /*  34 " */
+    {    14,  8 },   /*  35 # */
+    {    22,  8 },   /*  36 $ */
+    {    30,  8 },   /*  37 % */
+    {    38,  8 },   /*  38 & */
+    {    46,  4 },   /*  39 ' */
+    {    50,  5 },   /*  40 ( */
+    {    55,  5 },   /*  41 ) */
+    {    60,  8 },   /*  42 * */
+    {    68,  7 },   /*  43 + */
+    {    75,  4 },   /*  44 , */
+    {    79,  8 },   /*  45 - */
+    {    87,  4 },   /*  46 . */
+    {    91,  8 },   /*  47 / */
+    {    99,  8 },   /*  48 0 */
+    {   107,  7 },   /*  49 1 */
+    {   114,  8 },   /*  50 2 */
+    {   122,  8 },   /*  51 3 */
+    {   130,  8 },   /*  52 4 */
+    {   138,  8 },   /*  53 5 */
+    {   146,  8 },   /*  54 6 */
+    {   154,  8 },   /*  55 7 */
+    {   162,  8 },   /*  56 8 */
+    {   170,  8 },   /*  57 9 */
+    {   178,  4 },   /*  58 : */
+    {   182,  4 },   /*  59 ; */
+    {   186,  6 },   /*  60 < */
+    {   192,  8 },   /*  61 = */
+    {   200,  6 },   /*  62 > */
+    {   206,  8 },   /*  63 ? */
+    {   214,  8 },   /*  64 @ */
+    {   222,  8 },   /*  65 A */
+    {   230,  8 },   /*  66 B */
+    {   238,  8 },   /*  67 C */
+    {   246,  8 },   /*  68 D */
+    {   254,  8 },   /*  69 E */
+    {   262,  8 },   /*  70 F */
+    {   270,  8 },   /*  71 G */
+    {   278,  8 },   /*  72 H */
+    {   286,  5 },   /*  73 I */
+    {   291,  7 },   /*  74 J */
+    {   298,  8 },   /*  75 K */
+    {   306,  8 },   /*  76 L */
+    {   314,  8 },   /*  77 M */
+    {   322,  8 },   /*  78 N */
+    {   330,  8 },   /*  79 O */
+    {   338,  8 },   /*  80 P */
+    {   346,  8 },   /*  81 Q */
+    {   354,  8 },   /*  82 R */
+    {   362,  8 },   /*  83 S */
+    {   370,  7 },   /*  84 T */
+    {   377,  8 },   /*  85 U */
+    {   385,  8 },   /*  86 V */
+    {   393,  8 },   /*  87 W */
+    {   401,  8 },   /*  88 X */
+    {   409,  7 },   /*  89 Y */
+    {   416,  8 },   /*  90 Z */
+    {   424,  6 },   /*  91 [ */
+    {   430,  8 },   /*  92   */
+    {   438,  6 },   /*  93 ] */
+    {   444,  8 },   /*  94 ^ */
+    {   452,  9 },   /*  95 _ */
+    {   461,  4 },   /*  96 ` */
+    {   465,  8 },   /*  97 a */
+    {   473,  8 },   /*  98 b */
+    {   481,  8 },   /*  99 c */
+    {   489,  8 },   /* 100 d */
+    {   497,  8 },   /* 101 e */
+    {   505,  8 },   /* 102 f */
+    {   513,  8 },   /* 103 g */
+    {   521,  8 },   /* 104 h */
+    {   529,  5 },   /* 105 i */
+    {   534,  7 },   /* 106 j */
+    {   541,  8 },   /* 107 k */
+    {   549,  4 },   /* 108 l */
+    {   553,  8 },   /* 109 m */
+    {   561,  8 },   /* 110 n */
+    {   569,  8 },   /* 111 o */
+    {   577,  8 },   /* 112 p */
+    {   585,  8 },   /* 113 q */
+    {   593,  8 },   /* 114 r */
+    {   601,  8 },   /* 115 s */
+    {   609,  8 },   /* 116 t */
+    {   617,  8 },   /* 117 u */
+    {   625,  8 },   /* 118 v */
+    {   633,  8 },   /* 119 w */
+    {   641,  8 },   /* 120 x */
+    {   649,  8 },   /* 121 y */
+    {   657,  7 },   /* 122 z */
+    {   664,  7 },   /* 123 { */
+    {   671,  3 },   /* 124 | */
+    {   674,  7 },   /* 125 } */
+    {   681,  8 },   /* 126 ~ */
+};
+
+const struct Font Font_Prop8 = {
+    8, 32, 95, FONT_PACKED, 1, Font_Prop8_glyphs, Font_Prop8_bits
+};
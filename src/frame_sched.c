@@ -0,0 +1,186 @@
+/*
+ * Description:
+ *
+ * Frame pacing for the LCD pushes, with frame time statistics
+ *
+ * Rendering only touches the framebuffer, the scheduler pushes at most once
+ * per frame period and only when something changed, so any number of
+ * render calls between frames coalesce into one push.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "frame_sched.h"
+#include "simple_lcd.h"
+#include "lcd_config.h"
+#include "platform_config.h"
+#include "systick.h"
+#include "text_fmt.h"
+
+static unsigned int frame_msecs = 1000 / LCD_TARGET_FPS;
+static unsigned int next_due = 0;
+static unsigned int last_push = 0;
+static int pushed_once = 0;
+static int started = 0;
+static uint32_t push_start;
+static struct FrameStats frame_stats;
+
+/* the log2 histogram bucket of a value */
+static unsigned int bucket(uint32_t value)
+{
+    unsigned int b = 0;
+    while (value && b < FRAME_HIST_BUCKETS - 1)
+    {
+        value >>= 1;
+        ++b;
+    }
+    return b;
+}
+
+/* a push has gone out, count how long it took */
+static void pushDone(void)
+{
+    frame_stats.push_us[bucket((getCycleCount() - push_start) / SYSCLK_MHZ / 64)]++;
+}
+
+/* set the target frame rate in frames per second */
+void FrameSchedSetFPS(unsigned int fps)
+{
+    if (!fps)
+        fps = 1;
+    frame_msecs = (1000 + fps - 1) / fps;
+    if (!frame_msecs)
+        frame_msecs = 1;
+}
+
+/* push the framebuffer when a frame is due and something changed */
+int FrameSchedPoll(void)
+{
+    unsigned int now = getSysTick_mSecs();
+    unsigned int missed;
+
+    /* keeps the LCD bring-up and background jobs moving between frames */
+    if (LCDPoll())
+        return 0;
+#if !LCD_DOUBLE_BUFFER
+    if (PushBusy())
+        return 0;
+#endif
+    /* the first frame is due on the first poll, the time spent booting is no missed frames */
+    if (!started)
+    {
+        next_due = now;
+        started = 1;
+    }
+    if ((int)(now - next_due) < 0)
+        return 0;
+
+    /* whole frame periods that went by before the loop came round */
+    missed = (now - next_due) / frame_msecs;
+
+    if (!LCDIsDirty())
+    {
+        next_due += (missed + 1) * frame_msecs;
+        frame_stats.idle++;
+        return 0;
+    }
+
+#if LCD_DOUBLE_BUFFER
+    if (PushBusy())
+    {
+        /* with a push still in flight the frame stays due, drawing carries on in the back buffer */
+        if (LCDPresent() < 0)
+            return 0;
+    }
+    else
+    {
+        /* the push is timed to its end, when the DMA done interrupt calls back */
+        push_start = getCycleCount();
+        if (PushBufferAsync(pushDone) < 0)
+            return 0;
+    }
+#else
+    push_start = getCycleCount();
+    PushBuffer();
+    pushDone();
+#endif
+    next_due += (missed + 1) * frame_msecs;
+
+    if (pushed_once)
+        frame_stats.frame_ms[bucket(now - last_push)]++;
+    pushed_once = 1;
+    last_push = now;
+
+    frame_stats.frames++;
+    frame_stats.dropped += missed;
+    frame_stats.drops[bucket(missed)]++;
+    return 1;
+}
+
+/* copy out the scheduler counters */
+void FrameSchedGetStats(struct FrameStats* stats)
+{
+    *stats = frame_stats;
+}
+
+/* append a histogram, returns the new end */
+static char* appendHistogram(char* buf, const char* name, const uint32_t hist[FRAME_HIST_BUCKETS])
+{
+    unsigned int i;
+
+    buf = FmtAppendString(buf, name);
+    for (i = 0; i < FRAME_HIST_BUCKETS; ++i)
+    {
+        *buf++ = ' ';
+        buf = FmtAppendNumber(buf, hist[i]);
+    }
+    return buf;
+}
+
+/* format line number line of a text report of the counters into buf, returns its length or 0 past the last line */
+unsigned int FrameSchedReportLine(unsigned int line, char* buf)
+{
+    char* end = buf;
+
+    switch (line)
+    {
+    case 0:
+        end = FmtAppendString(end, "frames ");
+        end = FmtAppendNumber(end, frame_stats.frames);
+        end = FmtAppendString(end, " idle ");
+        end = FmtAppendNumber(end, frame_stats.idle);
+        end = FmtAppendString(end, " dropped ");
+        end = FmtAppendNumber(end, frame_stats.dropped);
+        end = FmtAppendString(end, " period_ms ");
+        end = FmtAppendNumber(end, frame_msecs);
+        break;
+    case 1:
+        end = appendHistogram(end, "frame_ms", frame_stats.frame_ms);
+        break;
+    case 2:
+        end = appendHistogram(end, "push_64us", frame_stats.push_us);
+        break;
+    case 3:
+        end = appendHistogram(end, "drops", frame_stats.drops);
+        break;
+    default:
+        return 0;
+    }
+
+    end = FmtAppendString(end, "\r\n");
+    *end = '\0';
+    return end - buf;
+}
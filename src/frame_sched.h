@@ -0,0 +1,60 @@
+/*
+ * Description:
+ *
+ * Frame pacing for the LCD pushes, with frame time statistics
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __FRAME_SCHED_H__
+#define __FRAME_SCHED_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* histogram buckets, bucket 0 counts 0, bucket n counts [2^(n-1), 2^n) and the last counts the rest */
+#define FRAME_HIST_BUCKETS  8
+
+/* frame scheduler counters */
+struct FrameStats
+{
+    uint32_t frames;                        /* frames pushed */
+    uint32_t idle;                          /* frames due with nothing to push */
+    uint32_t dropped;                       /* frames missed because the loop came late */
+    uint32_t frame_ms[FRAME_HIST_BUCKETS];  /* time between pushes, mSecs */
+    uint32_t push_us[FRAME_HIST_BUCKETS];   /* push duration to the last byte sent, in units of 64 uSecs */
+    uint32_t drops[FRAME_HIST_BUCKETS];     /* frames missed before each push */
+};
+
+/* longest line from FrameSchedReportLine(), with the terminating zero */
+#define FRAME_REPORT_LINE_MAX 100
+
+/* set the target frame rate in frames per second */
+void FrameSchedSetFPS(unsigned int fps);
+/* call from the main loop, pushes the framebuffer when a frame is due and something changed.
+ * Returns non-zero if a frame was pushed */
+int FrameSchedPoll(void);
+/* copy out the scheduler counters */
+void FrameSchedGetStats(struct FrameStats* stats);
+/* format line number line of a text report of the counters into buf, returns its length or 0 past the last line */
+unsigned int FrameSchedReportLine(unsigned int line, char* buf);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __FRAME_SCHED_H__
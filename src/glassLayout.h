@@ -37,6 +37,27 @@
 #define LCD_CHAR_WIDTH          6
 #define LCD_CHAR_HEIGHT         8
 
+/* the glass rows are split over two banks of controller lines */
+#define LCD_BANK_ROWS           34
+#define LCD_BANK0_LINE          46
+#define LCD_BANK1_LINE          126
+#define LCD_START_COLUMN        3
+/* lines of display RAM the controller drives */
+#define LCD_CONTROLLER_LINES    160
+/* a display RAM line that is not on the glass, free for bus tests */
+#define LCD_SCRATCH_LINE        0
+
+/* The glass as windows of controller display RAM, in framebuffer row order:
+ *   W(first framebuffer row, rows, first controller line, first column, last column, pad pixels)
+ * The pad pixels are the unmapped ones at the start of each row, they are written as dummies.
+ * The push engines walk the descriptors built from this list, so another panel only changes it. */
+#define LCD_GLASS_WINDOWS(W) \
+    W(0,             LCD_BANK_ROWS, LCD_BANK0_LINE, LCD_START_COLUMN, LCD_START_COLUMN + LCD_COLUMNS - 1, LCD_UNMAPPED_LINES) \
+    W(LCD_BANK_ROWS, LCD_BANK_ROWS, LCD_BANK1_LINE, LCD_START_COLUMN, LCD_START_COLUMN + LCD_COLUMNS - 1, LCD_UNMAPPED_LINES)
+
+#define LCD_GLASS_WINDOW_ONE(ROW, ROWS, LINE, COL0, COL1, PAD) + 1
+#define LCD_GLASS_WINDOW_COUNT  (0 LCD_GLASS_WINDOWS(LCD_GLASS_WINDOW_ONE))
+
 #define LCD_PIXELS_ACROSS       ( LCD_COLUMNS * LCD_PIXELS_PER_COLUMN )
 #define LCD_PIXELS              ( LCD_LINES * LCD_PIXELS_ACROSS )
 #define LCD_UNMAPPED_PIXELS     (LCD_UNMAPPED_LINES * LCD_LINES)
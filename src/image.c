@@ -0,0 +1,176 @@
+/*
+ * Description:
+ *
+ * Gray scale images stored in flash, raw or run length encoded. Images are
+ * decoded a row at a time as they are drawn, straight into the framebuffer
+ * where its format allows, so no buffer the size of the image is needed.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "image.h"
+#include "simple_lcd.h"
+#include "st7529_core.h"
+
+/* where decoding has got to in an image's data */
+struct ImageStream
+{
+    const uint8_t* src;
+    unsigned int run;   /* bytes left in the current run */
+    uint8_t literal;    /* the run is copied from src, not repeated */
+    uint8_t value;      /* the byte repeated */
+};
+
+/* a row of packed pixels, and the same row as gray bytes when it cannot be expanded into the framebuffer */
+static uint8_t row_bits[IMAGE_MAX_WIDTH];
+#if !(LCD_FRAMEBUFFER && LCD_FB_BPP == 8)
+static uint8_t row_gray[IMAGE_MAX_WIDTH];
+#endif
+
+/* the next count bytes of the packed rows into out */
+static void unpack(struct ImageStream* s, uint8_t encoding, uint8_t* out, unsigned int count)
+{
+    if (encoding == IMAGE_RAW)
+    {
+        memcpy(out, s->src, count);
+        s->src += count;
+        return;
+    }
+
+    while (count)
+    {
+        unsigned int n;
+
+        if (!s->run)
+        {
+            uint8_t c = *s->src++;
+            s->literal = c < 128;
+            if (s->literal)
+                s->run = c + 1;
+            else
+            {
+                s->run = c - 126;
+                s->value = *s->src++;
+            }
+        }
+
+        n = s->run < count ? s->run : count;
+        if (s->literal)
+        {
+            memcpy(out, s->src, n);
+            s->src += n;
+        }
+        else
+            memset(out, s->value, n);
+        out += n;
+        count -= n;
+        s->run -= n;
+    }
+}
+
+/* expand pixels first..first + count - 1 of a packed row to gray bytes */
+static void expand(const uint8_t* bits, unsigned int bpp, unsigned int first, unsigned int count, uint8_t* out)
+{
+    static uint8_t gray[3][16];
+    static int gray_valid = 0;
+    const uint8_t* levels;
+    unsigned int max = (1 << bpp) - 1, i;
+
+    if (!gray_valid)
+    {
+        /* even steps from white to black for 1, 2 and 4 bit levels */
+        for (i = 0; i < 16; ++i)
+        {
+            if (i < 2)
+                gray[0][i] = i * BLACK;
+            if (i < 4)
+                gray[1][i] = i * BLACK / 3;
+            gray[2][i] = i * BLACK / 15;
+        }
+        gray_valid = 1;
+    }
+    levels = gray[bpp >> 1];
+
+    for (i = first; i < first + count; ++i)
+    {
+        unsigned int shift = 8 - bpp - (i * bpp) % 8;
+        *out++ = levels[(bits[i * bpp / 8] >> shift) & max];
+    }
+}
+
+/* draw an image with its top left at x,y */
+void ImageDraw(const struct Image* image, int x, int y)
+{
+    struct ImageStream s = { image->data, 0, 0, 0 };
+    unsigned int row_bytes = (image->width * image->bpp + 7) / 8;
+    unsigned int first, count, row;
+#if LCD_FRAMEBUFFER && LCD_FB_BPP == 8
+    uint8_t* fb = LCDGetFramebuffer();
+    unsigned int top = 0, rows = 0;
+#endif
+
+    /* the columns on the glass */
+    if (image->width > IMAGE_MAX_WIDTH || x >= LCD_USABLE_PIXELS_PER_ROW || x + image->width <= 0)
+        return;
+    first = x < 0 ? -x : 0;
+    count = image->width - first;
+    if (x + image->width > LCD_USABLE_PIXELS_PER_ROW)
+        count = LCD_USABLE_PIXELS_PER_ROW - x - first;
+
+    for (row = 0; row < image->height; ++row)
+    {
+        int line = y + (int)row;
+
+        if (line >= LCD_LINES)
+            break;
+#if LCD_FRAMEBUFFER && LCD_FB_BPP == 8
+        /* whole rows of 8 bit images are decoded straight into the framebuffer */
+        if (line >= 0 && image->bpp == 8 && count == image->width)
+        {
+            unpack(&s, image->encoding, fb + line * LCD_FB_STRIDE + x, row_bytes);
+            top = rows ? top : line;
+            ++rows;
+            continue;
+        }
+#endif
+        unpack(&s, image->encoding, row_bits, row_bytes);
+        if (line < 0)
+            continue;
+
+#if LCD_FRAMEBUFFER && LCD_FB_BPP == 8
+        if (image->bpp == 8)
+            memcpy(fb + line * LCD_FB_STRIDE + x + first, row_bits + first, count);
+        else
+            expand(row_bits, image->bpp, first, count, fb + line * LCD_FB_STRIDE + x + first);
+        top = rows ? top : line;
+        ++rows;
+#else
+        if (image->bpp == 8)
+            LCDBlit(x + first, line, count, 1, row_bits + first);
+        else
+        {
+            expand(row_bits, image->bpp, first, count, row_gray);
+            LCDBlit(x + first, line, count, 1, row_gray);
+        }
+#endif
+    }
+
+#if LCD_FRAMEBUFFER && LCD_FB_BPP == 8
+    if (rows)
+        LCDMarkDirty(x + first, top, count, rows);
+#endif
+}
@@ -0,0 +1,55 @@
+/*
+ * Description:
+ *
+ * Gray scale images stored in flash, raw or run length encoded, drawn a row at a time
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the widest image, in pixels */
+#define IMAGE_MAX_WIDTH     256
+
+/* image encodings, both over the pixel rows packed bpp bits a pixel MSB first, each row padded to a byte */
+#define IMAGE_RAW           0   /* the packed rows as they are */
+#define IMAGE_RLE           1   /* PackBits runs over the packed rows: a control byte n, then n + 1 bytes
+                                 * copied for n < 128, or one byte repeated n - 126 times */
+
+/* an image, made from a PGM file by tools/pgm2image. Pixels of 1, 2 and 4 bit images are gray levels from
+ * white (0) to black (all ones), pixels of 8 bit images are controller gray bytes */
+struct Image
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t bpp;        /* bits per pixel: 1, 2, 4 or 8 */
+    uint8_t encoding;   /* IMAGE_RAW or IMAGE_RLE */
+    const uint8_t* data;
+};
+
+/* draw an image with its top left at x,y, clipped to the glass */
+void ImageDraw(const struct Image* image, int x, int y);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __IMAGE_H__
@@ -20,25 +20,15 @@
  * limitations under the License.
  */
 #include "keys.h"
+#include "lcd_bus.h"
 #include "stm32f10x.h"
 
 /* read the keys' state on the key bus and return the bits on that bus */
 uint16_t ReadKeys(void)
 {
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_StructInit(&GPIO_InitStructure);
-
-    /* Config the key pins in an input mode away from the LCD of which they are shared with */
-    /* note that this must be done before reading the keys as the LCD code will reconfigure these lines */
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IPD;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_InitStructure.GPIO_Pin = KEY_UP_PIN |  KEY_DOWN_PIN |  KEY_LEFT_PIN | KEY_RIGHT_PIN | KEY_ENTER_PIN | KEY_CANCEL_PIN;
-
-    RCC_APB2PeriphClockCmd(KEYS_GPIO_CLK, ENABLE);
-
-    GPIO_Init(KEYS_GPIO, &GPIO_InitStructure);
-
-    return GPIO_ReadInputData(KEYS_GPIO) & (KEY_UP_PIN |  KEY_DOWN_PIN |  KEY_LEFT_PIN | KEY_RIGHT_PIN | KEY_ENTER_PIN | KEY_CANCEL_PIN);
+    /* the key pins are shared with the LCD, the bus arbiter switches them to inputs
+     * when needed and reuses a recent sample taken between LCD windows */
+    return LCDBusReadKeys();
 }
 
 /* A simple toggle of the Keypad Backlight enable line, additional control may be gained by using the associated DAC */
@@ -0,0 +1,200 @@
+/*
+ * Description:
+ *
+ * On target benchmarks of the LCD bus and drawing paths, timed with the core cycle counter
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "lcd_bench.h"
+#include "lcd_draw.h"
+#include "simple_lcd.h"
+#include "st7529_core.h"
+#include "systick.h"
+#include "text_fmt.h"
+#include "lcd_config.h"
+#include "platform_config.h"
+
+/* bytes pushed through each bus path, about a frame */
+#define LCD_BENCH_BUS_BYTES     16384
+
+/* each primitive is drawn this often, in turn black and white so every pixel changes */
+#define LCD_BENCH_DRAWS         32
+
+/* a primitive drawn by a benchmark, the i-th time */
+typedef void (*BenchDrawFunc)(unsigned int i);
+
+static void drawHSpan(unsigned int i)
+{
+    DrawHSpan(0, i % LCD_LINES, LCD_USABLE_PIXELS_PER_ROW, i & 1 ? WHITE : BLACK);
+}
+
+static void drawVSpan(unsigned int i)
+{
+    DrawVSpan(i % LCD_USABLE_PIXELS_PER_ROW, 0, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillRect(unsigned int i)
+{
+    DrawFillRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawRect(unsigned int i)
+{
+    DrawRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawLine(unsigned int i)
+{
+    DrawLine(0, 0, LCD_USABLE_PIXELS_PER_ROW - 1, LCD_LINES - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawCircle(unsigned int i)
+{
+    DrawCircle(LCD_USABLE_PIXELS_PER_ROW / 2, LCD_LINES / 2, LCD_LINES / 2 - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillCircle(unsigned int i)
+{
+    DrawFillCircle(LCD_USABLE_PIXELS_PER_ROW / 2, LCD_LINES / 2, LCD_LINES / 2 - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillRoundRect(unsigned int i)
+{
+    DrawFillRoundRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, 8, i & 1 ? WHITE : BLACK);
+}
+
+/* the primitives timed, pixels drawn each time where that is exact, otherwise whole shapes */
+static const struct
+{
+    const char* name;
+    const char* unit;
+    uint32_t units;
+    BenchDrawFunc draw;
+} draw_benches[] =
+{
+    { "hspan",      "pixels", LCD_USABLE_PIXELS_PER_ROW,                         drawHSpan },
+    { "vspan",      "pixels", LCD_LINES,                                         drawVSpan },
+    { "fillrect",   "pixels", LCD_USABLE_PIXELS_PER_ROW * LCD_LINES,             drawFillRect },
+    { "rect",       "pixels", 2 * (LCD_USABLE_PIXELS_PER_ROW + LCD_LINES) - 4,   drawRect },
+    { "line",       "pixels", LCD_USABLE_PIXELS_PER_ROW,                         drawLine },
+    { "circle",     "shapes", 1,                                                 drawCircle },
+    { "fillcircle", "shapes", 1,                                                 drawFillCircle },
+    { "fillrrect",  "shapes", 1,                                                 drawFillRoundRect },
+};
+
+static struct LCDBenchResult results[LCD_BENCH_RESULTS];
+static unsigned int result_count = 0;
+static int run_failed = 0;
+
+/* record a result */
+static void addResult(const char* name, const char* unit, uint32_t units, uint32_t cycles)
+{
+    if (result_count == LCD_BENCH_RESULTS)
+        return;
+    results[result_count].name = name;
+    results[result_count].unit = unit;
+    results[result_count].units = units;
+    results[result_count].cycles = cycles;
+    result_count++;
+}
+
+/* run the benchmarks */
+int LCDBenchRun(void)
+{
+    uint32_t stream_cycles, byte_cycles;
+    unsigned int b, i;
+
+    result_count = 0;
+    run_failed = LCDPoll() || PushBusy();
+    if (run_failed)
+        return -1;
+
+    /* the pixel stream against the byte at a time path it replaced */
+    if (ST7529_benchBus(LCD_BENCH_BUS_BYTES, &stream_cycles, &byte_cycles) == 0)
+    {
+        addResult("bus stream", "bytes", LCD_BENCH_BUS_BYTES, stream_cycles);
+        addResult("bus single", "bytes", LCD_BENCH_BUS_BYTES, byte_cycles);
+    }
+
+    /* the drawing primitives into the framebuffer, or straight to the glass without one */
+    for (b = 0; b < sizeof(draw_benches) / sizeof(draw_benches[0]); ++b)
+    {
+        uint32_t start = getCycleCount();
+
+        for (i = 0; i < LCD_BENCH_DRAWS; ++i)
+            draw_benches[b].draw(i);
+        addResult(draw_benches[b].name, draw_benches[b].unit, draw_benches[b].units * LCD_BENCH_DRAWS,
+                  getCycleCount() - start);
+    }
+
+    /* what the primitives left behind goes, the caller redraws its screen */
+    LCDClear();
+    return result_count;
+}
+
+/* copy out a result */
+int LCDBenchGetResult(unsigned int i, struct LCDBenchResult* result)
+{
+    if (i >= result_count)
+        return -1;
+    *result = results[i];
+    return 0;
+}
+
+/* units per second for units of work done in cycles, kept in 32 bits for runs of up to a second or so */
+static uint32_t perSecond(uint32_t units, uint32_t cycles)
+{
+    uint32_t us = cycles / SYSCLK_MHZ;
+    uint32_t rest;
+
+    if (!us)
+        us = 1;
+    rest = units % us;
+    return units / us * 1000000 + rest * 1000 / us * 1000 + rest * 1000 % us * 1000 / us;
+}
+
+/* format a line of the report */
+unsigned int LCDBenchReportLine(unsigned int line, char* buf)
+{
+    const struct LCDBenchResult* r;
+    char* end = buf;
+
+    if (run_failed && line == 0)
+        end = FmtAppendString(end, "lcd busy");
+    else if (line < result_count)
+    {
+        r = &results[line];
+        end = FmtAppendString(end, r->name);
+        *end++ = ' ';
+        end = FmtAppendNumber(end, r->units);
+        *end++ = ' ';
+        end = FmtAppendString(end, r->unit);
+        end = FmtAppendString(end, " cycles ");
+        end = FmtAppendNumber(end, r->cycles);
+        *end++ = ' ';
+        end = FmtAppendNumber(end, perSecond(r->units, r->cycles));
+        *end++ = ' ';
+        end = FmtAppendString(end, r->unit);
+        end = FmtAppendString(end, "/s");
+    }
+    else
+        return 0;
+
+    end = FmtAppendString(end, "\r\n");
+    *end = '\0';
+    return end - buf;
+}
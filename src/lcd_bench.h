@@ -0,0 +1,55 @@
+/*
+ * Description:
+ *
+ * On target benchmarks of the LCD bus and drawing paths, timed with the core cycle counter
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __LCD_BENCH_H__
+#define __LCD_BENCH_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* most results a run gives */
+#define LCD_BENCH_RESULTS       16
+/* longest line from LCDBenchReportLine(), with the terminating zero */
+#define LCD_BENCH_LINE_MAX      80
+
+/* one benchmark: units of work done in cycles core cycles */
+struct LCDBenchResult
+{
+    const char* name;
+    const char* unit;
+    uint32_t units;
+    uint32_t cycles;
+};
+
+/* run the benchmarks, blocking until they are done. The drawing benchmarks leave the screen cleared.
+ * Returns the number of results, or -1 if the LCD was not ready or a push was in flight */
+int LCDBenchRun(void);
+/* copy out result i of the last run, returns -1 past the last */
+int LCDBenchGetResult(unsigned int i, struct LCDBenchResult* result);
+/* format line number line of a text report of the last run into buf, returns its length or 0 past the last line */
+unsigned int LCDBenchReportLine(unsigned int line, char* buf);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __LCD_BENCH_H__
@@ -0,0 +1,144 @@
+/*
+ * Description:
+ *
+ * Ownership of the data bus shared by the LCD controller and the keypad
+ *
+ * The pin mode is cached and changed with a single GPIOx->CRL write, so
+ * taking the bus when it is already set up costs a compare. Key samples
+ * are taken between LCD windows when one is due, so the keys rarely need
+ * a bus turnaround of their own.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "stm32f10x.h"
+#include "lcd_bus.h"
+#include "platform_config.h"
+#include "systick.h"
+
+/* bus pin configurations for GPIOx->CRL, one nibble per pin 0..7 */
+#define LCD_BUS_CRL_LCD_WRITE   0x22222222  // general purpose output push-pull, 2MHz
+#define LCD_BUS_CRL_LCD_READ    0x44444444  // floating input
+#define LCD_BUS_CRL_KEYS        0x22888888  // keys on 0..5 input with pull-down, 6..7 left driven
+
+/* the key pins */
+#define LCD_BUS_KEY_PINS        (KEY_UP_PIN | KEY_DOWN_PIN | KEY_LEFT_PIN | KEY_RIGHT_PIN | KEY_ENTER_PIN | KEY_CANCEL_PIN)
+
+/* a key sample younger than this is reused rather than taking the bus again */
+#ifndef LCD_BUS_KEY_PERIOD_MS
+#define LCD_BUS_KEY_PERIOD_MS   2
+#endif
+
+/* time for a pressed key to pull its line up once the pins are inputs */
+#define LCD_BUS_KEY_SETTLE_CYCLES (1 * SYSCLK_MHZ)
+
+static volatile lcd_bus_mode_t bus_mode = LCD_BUS_UNKNOWN;
+static volatile int bus_locked = 0;
+static volatile uint16_t last_keys = 0;
+static volatile unsigned int last_keys_msecs = 0;
+static volatile int have_keys = 0;
+static struct LCDBusStats bus_stats;
+
+/* enable the bus clocks and put the bus in LCD write mode */
+void LCDBusInit(void)
+{
+    RCC_APB2PeriphClockCmd(ST7529_DATA_GPIO_CLK | KEYS_GPIO_CLK, ENABLE);
+    bus_mode = LCD_BUS_UNKNOWN;
+    LCDBusAcquire(LCD_BUS_LCD_WRITE);
+}
+
+/* set the bus pins up for mode, does nothing if they already are */
+void LCDBusAcquire(lcd_bus_mode_t mode)
+{
+    uint32_t start;
+
+    if (bus_mode == mode)
+        return;
+
+    start = getCycleCount();
+    switch (mode)
+    {
+    case LCD_BUS_LCD_READ:
+        ST7529_DATA_GPIO->CRL = LCD_BUS_CRL_LCD_READ;
+        break;
+    case LCD_BUS_KEYS:
+        /* drive the lines low first, the zeros in ODR then select the pull-downs */
+        ST7529_DATA_GPIO->BRR = ST7529_DATA_PINS;
+        KEYS_GPIO->CRL = LCD_BUS_CRL_KEYS;
+        break;
+    default:
+        ST7529_DATA_GPIO->CRL = LCD_BUS_CRL_LCD_WRITE;
+        mode = LCD_BUS_LCD_WRITE;
+        break;
+    }
+    bus_mode = mode;
+
+    bus_stats.switches++;
+    bus_stats.switch_cycles += getCycleCount() - start;
+}
+
+/* lock / unlock the bus for a background push */
+void LCDBusLock(int locked)
+{
+    bus_locked = locked;
+}
+
+/* take a key sample, the bus is left in key mode */
+static uint16_t sampleKeys(void)
+{
+    uint32_t start;
+
+    LCDBusAcquire(LCD_BUS_KEYS);
+    start = getCycleCount();
+    while (getCycleCount() - start < LCD_BUS_KEY_SETTLE_CYCLES) ;
+
+    last_keys = KEYS_GPIO->IDR & LCD_BUS_KEY_PINS;
+    last_keys_msecs = getSysTick_mSecs();
+    have_keys = 1;
+    bus_stats.key_samples++;
+    return last_keys;
+}
+
+/* check for a key sample young enough to reuse */
+static int keysFresh(void)
+{
+    return have_keys && getSysTick_mSecs() - last_keys_msecs < LCD_BUS_KEY_PERIOD_MS;
+}
+
+/* called between LCD windows, samples the keys if a sample is due */
+void LCDBusGap(void)
+{
+    if (!keysFresh())
+    {
+        sampleKeys();
+        bus_stats.gap_samples++;
+    }
+    LCDBusAcquire(LCD_BUS_LCD_WRITE);
+}
+
+/* return the key bits, sampling them if the latest sample is too old and the bus is free */
+uint16_t LCDBusReadKeys(void)
+{
+    if (bus_locked || keysFresh())
+        return last_keys;
+    return sampleKeys();
+}
+
+/* copy out the arbiter counters */
+void LCDBusGetStats(struct LCDBusStats* stats)
+{
+    *stats = bus_stats;
+}
@@ -0,0 +1,64 @@
+/*
+ * Description:
+ *
+ * Ownership of the data bus shared by the LCD controller and the keypad
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __LCD_BUS_H__
+#define __LCD_BUS_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* the ways the shared bus pins can be set up */
+typedef enum
+{
+    LCD_BUS_UNKNOWN,        /* not yet set up, or changed behind the arbiter's back */
+    LCD_BUS_LCD_WRITE,      /* outputs driving the LCD data lines */
+    LCD_BUS_LCD_READ,       /* floating inputs reading the LCD data lines */
+    LCD_BUS_KEYS            /* pulled down inputs reading the keys */
+} lcd_bus_mode_t;
+
+/* bus arbiter counters */
+struct LCDBusStats
+{
+    uint32_t switches;      /* pin mode changes */
+    uint32_t switch_cycles; /* core cycles spent changing the pin mode */
+    uint32_t key_samples;   /* key samples taken */
+    uint32_t gap_samples;   /* of those, taken in the gaps between LCD windows */
+};
+
+/* enable the bus clocks and put the bus in LCD write mode */
+void LCDBusInit(void);
+/* set the bus pins up for mode, does nothing if they already are */
+void LCDBusAcquire(lcd_bus_mode_t mode);
+/* lock / unlock the bus for a background push, key reads return the latest gap sample while locked */
+void LCDBusLock(int locked);
+/* called between LCD windows with nCS high, samples the keys if a sample is due and leaves the bus in LCD write mode */
+void LCDBusGap(void);
+/* return the key bits, sampling them if the latest sample is too old and the bus is free */
+uint16_t LCDBusReadKeys(void);
+/* copy out the arbiter counters */
+void LCDBusGetStats(struct LCDBusStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __LCD_BUS_H__
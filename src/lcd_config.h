@@ -0,0 +1,102 @@
+/*
+ * Description:
+ *
+ * Build time options for the LCD framebuffer and push path.
+ *
+ * Each option may be overridden from the compiler command line (-D).
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LCD_CONFIG_H__
+#define __LCD_CONFIG_H__
+
+#include "glassLayout.h"
+
+/* Keep a framebuffer in RAM (1), or none at all (0): drawing then goes straight
+ * into the controller's display RAM and there is nothing to push. */
+#ifndef LCD_FRAMEBUFFER
+#define LCD_FRAMEBUFFER         1
+#endif
+
+/* frames per second the pushes are paced to */
+#ifndef LCD_TARGET_FPS
+#define LCD_TARGET_FPS          30
+#endif
+
+/* Framebuffer bits per pixel: 8 (gray byte per pixel), 4, 2 or 1.
+ * Packed formats store gray levels MSB first and are expanded to the
+ * controller's gray bytes while pushing. */
+#ifndef LCD_FB_BPP
+#define LCD_FB_BPP              8
+#endif
+
+#if LCD_FB_BPP != 8 && LCD_FB_BPP != 4 && LCD_FB_BPP != 2 && LCD_FB_BPP != 1
+#error "LCD_FB_BPP must be 8, 4, 2 or 1"
+#endif
+
+/* bytes per framebuffer row, packed rows are padded to a whole word */
+#if LCD_FB_BPP == 8
+#define LCD_FB_STRIDE           LCD_USABLE_PIXELS_PER_ROW
+#else
+#define LCD_FB_STRIDE           ((((LCD_USABLE_PIXELS_PER_ROW * LCD_FB_BPP + 7) / 8) + 3) & ~3)
+#endif
+#define LCD_FB_PIXELS_PER_BYTE  (8 / LCD_FB_BPP)
+#define LCD_FB_LEVELS           (1 << LCD_FB_BPP)
+#define LCD_FB_BYTE_CNT         (LCD_FB_STRIDE * LCD_LINES)
+
+/* Keep a second framebuffer (1): drawing goes into the back buffer while the front
+ * buffer is pushed, the two are swapped when a frame is presented. */
+#ifndef LCD_DOUBLE_BUFFER
+#define LCD_DOUBLE_BUFFER       0
+#endif
+
+/* RAM the framebuffers may take, the rest of the 48KB holds the stack, the USB and
+ * UART rings and the font */
+#ifndef LCD_FB_RAM_BUDGET
+#define LCD_FB_RAM_BUDGET       (36 * 1024)
+#endif
+
+#if LCD_DOUBLE_BUFFER && !LCD_FRAMEBUFFER
+#error "LCD_DOUBLE_BUFFER needs LCD_FRAMEBUFFER"
+#endif
+
+#if LCD_FRAMEBUFFER && (1 + LCD_DOUBLE_BUFFER) * LCD_FB_BYTE_CNT > LCD_FB_RAM_BUDGET
+#error "the framebuffers do not fit in LCD_FB_RAM_BUDGET"
+#endif
+
+/* Controller gray scale packing on the bus:
+ * LCD_GRAY_3B3P - one byte per pixel, 32 gray levels
+ * LCD_GRAY_2B3P - two bytes per three pixels (5-6-5 bits), a third less bus traffic */
+#define LCD_GRAY_3B3P           3
+#define LCD_GRAY_2B3P           2
+
+#ifndef LCD_GRAY_PACKING
+#define LCD_GRAY_PACKING        LCD_GRAY_3B3P
+#endif
+
+#if LCD_GRAY_PACKING != LCD_GRAY_3B3P && LCD_GRAY_PACKING != LCD_GRAY_2B3P
+#error "LCD_GRAY_PACKING must be LCD_GRAY_3B3P or LCD_GRAY_2B3P"
+#endif
+
+/* bus bytes per controller column */
+#define LCD_BYTES_PER_COLUMN    LCD_GRAY_PACKING
+
+/* the background DMA push strobes framebuffer bytes straight onto the bus */
+#define LCD_PUSH_DMA_CAPABLE    (LCD_FRAMEBUFFER && LCD_FB_BPP == 8 && LCD_GRAY_PACKING == LCD_GRAY_3B3P)
+
+#endif /* __LCD_CONFIG_H__ */
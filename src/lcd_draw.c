@@ -0,0 +1,434 @@
+/*
+ * Description:
+ *
+ * 2D drawing primitives built from horizontal and vertical spans. Each primitive
+ * is checked against the clip rectangle once: shapes wholly inside draw their
+ * spans unchecked, shapes crossing it clip each span. Spans are filled straight
+ * in the framebuffer with word stores, or with LCDFillRect() without one.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "lcd_draw.h"
+#include "simple_lcd.h"
+
+#if LCD_FRAMEBUFFER && LCD_FB_BPP != 8
+/* pixels in each framebuffer byte, MSB first */
+#define LEVEL_MASK          (LCD_FB_LEVELS - 1)
+#define PIXEL_SHIFT(X)      ((LCD_FB_PIXELS_PER_BYTE - 1 - (X) % LCD_FB_PIXELS_PER_BYTE) * LCD_FB_BPP)
+#endif
+
+/* the clip rectangle, inclusive bounds */
+static int clip_x0 = 0, clip_y0 = 0;
+static int clip_x1 = LCD_USABLE_PIXELS_PER_ROW - 1, clip_y1 = LCD_LINES - 1;
+
+/* the primitive being drawn */
+static struct
+{
+    uint8_t* fb;        /* the framebuffer drawn into, 0 when drawing straight to display RAM */
+    int clipped;        /* non-zero when the shape crosses the clip rectangle */
+    int x0, y0, x1, y1; /* the shape's bounds within the clip rectangle */
+    uint8_t gray;
+    uint8_t pattern;    /* a framebuffer byte of gray pixels */
+} draw;
+
+/* set up drawing a shape bounded by x0,y0 - x1,y1, returns 0 if nothing of it is inside the clip rectangle */
+static int begin(int x0, int y0, int x1, int y1, uint8_t gray)
+{
+    if (x1 < clip_x0 || x0 > clip_x1 || y1 < clip_y0 || y0 > clip_y1 || x1 < x0 || y1 < y0)
+        return 0;
+
+    draw.clipped = x0 < clip_x0 || x1 > clip_x1 || y0 < clip_y0 || y1 > clip_y1;
+    draw.x0 = x0 < clip_x0 ? clip_x0 : x0;
+    draw.y0 = y0 < clip_y0 ? clip_y0 : y0;
+    draw.x1 = x1 > clip_x1 ? clip_x1 : x1;
+    draw.y1 = y1 > clip_y1 ? clip_y1 : y1;
+    draw.fb = LCDGetFramebuffer();
+    draw.gray = gray;
+#if LCD_FRAMEBUFFER && LCD_FB_BPP != 8
+    draw.pattern = (gray >> (8 - LCD_FB_BPP)) * (0xff / LEVEL_MASK);
+#else
+    draw.pattern = gray;
+#endif
+    return 1;
+}
+
+/* record the shape drawn for the next push */
+static void end(void)
+{
+    LCDMarkDirty(draw.x0, draw.y0, draw.x1 - draw.x0 + 1, draw.y1 - draw.y0 + 1);
+}
+
+#if LCD_FRAMEBUFFER
+/* fill count bytes from offset of a framebuffer row with the pattern, whole words at a time in the middle.
+ * Rows start on a word boundary, the framebuffer is word aligned and its stride a whole number of words */
+static void fillBytes(uint8_t* row, unsigned int offset, unsigned int count, uint8_t pattern)
+{
+    uint32_t word = pattern * 0x01010101u;
+    uint32_t* w;
+    uint8_t* p = row + offset;
+
+    for (; count && (offset & 3); --count, ++offset)
+        *p++ = pattern;
+
+    w = (uint32_t*)(void*)p;
+    for (; count >= 16; count -= 16, w += 4)
+    {
+        w[0] = word;
+        w[1] = word;
+        w[2] = word;
+        w[3] = word;
+    }
+    for (; count >= 4; count -= 4)
+        *w++ = word;
+
+    for (p = (uint8_t*)w; count; --count)
+        *p++ = pattern;
+}
+#endif
+
+/* fill pixels x0..x1 of row y, inside the clip rectangle */
+static void fillSpan(int x0, int x1, int y)
+{
+#if LCD_FRAMEBUFFER
+    uint8_t* row = draw.fb + y * LCD_FB_STRIDE;
+#if LCD_FB_BPP == 8
+    fillBytes(row, x0, x1 - x0 + 1, draw.pattern);
+#else
+    unsigned int b0 = x0 / LCD_FB_PIXELS_PER_BYTE, b1 = x1 / LCD_FB_PIXELS_PER_BYTE;
+    uint8_t m0 = 0xff >> (x0 % LCD_FB_PIXELS_PER_BYTE * LCD_FB_BPP);
+    uint8_t m1 = 0xff << PIXEL_SHIFT(x1);
+
+    /* the partly covered bytes at either end are merged, the ones between filled */
+    if (b0 == b1)
+        m0 &= m1;
+    row[b0] = (row[b0] & ~m0) | (draw.pattern & m0);
+    if (b0 != b1)
+    {
+        fillBytes(row, b0 + 1, b1 - b0 - 1, draw.pattern);
+        row[b1] = (row[b1] & ~m1) | (draw.pattern & m1);
+    }
+#endif
+#else
+    LCDFillRect(x0, y, x1 - x0 + 1, 1, draw.gray);
+#endif
+}
+
+/* fill rows y0..y1 of column x, inside the clip rectangle */
+static void fillColumn(int x, int y0, int y1)
+{
+#if LCD_FRAMEBUFFER
+#if LCD_FB_BPP == 8
+    uint8_t* p = draw.fb + y0 * LCD_FB_STRIDE + x;
+
+    for (; y0 <= y1; ++y0, p += LCD_FB_STRIDE)
+        *p = draw.pattern;
+#else
+    uint8_t* p = draw.fb + y0 * LCD_FB_STRIDE + x / LCD_FB_PIXELS_PER_BYTE;
+    uint8_t mask = LEVEL_MASK << PIXEL_SHIFT(x);
+    uint8_t bits = draw.pattern & mask;
+
+    for (; y0 <= y1; ++y0, p += LCD_FB_STRIDE)
+        *p = (*p & ~mask) | bits;
+#endif
+#else
+    LCDFillRect(x, y0, 1, y1 - y0 + 1, draw.gray);
+#endif
+}
+
+/* draw pixels x0..x1 of row y of the shape */
+static void hspan(int x0, int x1, int y)
+{
+    if (draw.clipped)
+    {
+        if (y < draw.y0 || y > draw.y1)
+            return;
+        if (x0 < draw.x0)
+            x0 = draw.x0;
+        if (x1 > draw.x1)
+            x1 = draw.x1;
+        if (x0 > x1)
+            return;
+    }
+    fillSpan(x0, x1, y);
+}
+
+/* draw rows y0..y1 of column x of the shape */
+static void vspan(int x, int y0, int y1)
+{
+    if (draw.clipped)
+    {
+        if (x < draw.x0 || x > draw.x1)
+            return;
+        if (y0 < draw.y0)
+            y0 = draw.y0;
+        if (y1 > draw.y1)
+            y1 = draw.y1;
+        if (y0 > y1)
+            return;
+    }
+    fillColumn(x, y0, y1);
+}
+
+/* quarter circles of radius r around the corner centres left,top - right,bottom, outlined or filled with spans
+ * out to the straight sides. Midpoint circle, one octant worked out and mirrored */
+static void corners(int left, int top, int right, int bottom, int r, int fill)
+{
+    int x = r, y = 0, d = 1 - r;
+
+    while (y <= x)
+    {
+        if (fill)
+        {
+            /* the rows y out, and the rows x out once y is the widest they get */
+            if (y)
+            {
+                hspan(left - x, right + x, top - y);
+                hspan(left - x, right + x, bottom + y);
+            }
+            if (d >= 0 && x != y)
+            {
+                hspan(left - y, right + y, top - x);
+                hspan(left - y, right + y, bottom + x);
+            }
+        }
+        else
+        {
+            hspan(right + x, right + x, bottom + y);
+            hspan(right + y, right + y, bottom + x);
+            hspan(left - x, left - x, bottom + y);
+            hspan(left - y, left - y, bottom + x);
+            hspan(right + x, right + x, top - y);
+            hspan(right + y, right + y, top - x);
+            hspan(left - x, left - x, top - y);
+            hspan(left - y, left - y, top - x);
+        }
+
+        if (d < 0)
+            d += 2 * y + 3;
+        else
+        {
+            d += 2 * (y - x) + 5;
+            --x;
+        }
+        ++y;
+    }
+}
+
+/* clip drawing to the w x h rectangle at x,y, and the glass */
+void DrawSetClip(int x, int y, unsigned int w, unsigned int h)
+{
+    DrawResetClip();
+    if (x > clip_x0)
+        clip_x0 = x;
+    if (y > clip_y0)
+        clip_y0 = y;
+    if (x + (int)w - 1 < clip_x1)
+        clip_x1 = x + (int)w - 1;
+    if (y + (int)h - 1 < clip_y1)
+        clip_y1 = y + (int)h - 1;
+}
+
+/* clip drawing to the whole glass */
+void DrawResetClip(void)
+{
+    clip_x0 = 0;
+    clip_y0 = 0;
+    clip_x1 = LCD_USABLE_PIXELS_PER_ROW - 1;
+    clip_y1 = LCD_LINES - 1;
+}
+
+/* set pixel x,y */
+void DrawPixel(int x, int y, uint8_t gray)
+{
+    if (!begin(x, y, x, y, gray))
+        return;
+    fillSpan(x, x, y);
+    end();
+}
+
+/* draw a horizontal run of w pixels from x,y */
+void DrawHSpan(int x, int y, unsigned int w, uint8_t gray)
+{
+    if (!begin(x, y, x + (int)w - 1, y, gray))
+        return;
+    fillSpan(draw.x0, draw.x1, y);
+    end();
+}
+
+/* draw a vertical run of h pixels down from x,y */
+void DrawVSpan(int x, int y, unsigned int h, uint8_t gray)
+{
+    if (!begin(x, y, x, y + (int)h - 1, gray))
+        return;
+    fillColumn(x, draw.y0, draw.y1);
+    end();
+}
+
+/* fill the w x h rectangle at x,y */
+void DrawFillRect(int x, int y, unsigned int w, unsigned int h, uint8_t gray)
+{
+    int row;
+
+    if (!begin(x, y, x + (int)w - 1, y + (int)h - 1, gray))
+        return;
+#if LCD_FRAMEBUFFER
+    for (row = draw.y0; row <= draw.y1; ++row)
+        fillSpan(draw.x0, draw.x1, row);
+#else
+    (void)row;
+    LCDFillRect(draw.x0, draw.y0, draw.x1 - draw.x0 + 1, draw.y1 - draw.y0 + 1, gray);
+#endif
+    end();
+}
+
+/* outline the w x h rectangle at x,y */
+void DrawRect(int x, int y, unsigned int w, unsigned int h, uint8_t gray)
+{
+    int x1 = x + (int)w - 1, y1 = y + (int)h - 1;
+
+    if (!begin(x, y, x1, y1, gray))
+        return;
+    hspan(x, x1, y);
+    hspan(x, x1, y1);
+    if (h > 2)
+    {
+        vspan(x, y + 1, y1 - 1);
+        vspan(x1, y + 1, y1 - 1);
+    }
+    end();
+}
+
+/* draw a line from x0,y0 to x1,y1. Bresenham, with the pixels of each row (or column for steep
+ * lines) drawn as one span */
+void DrawLine(int x0, int y0, int x1, int y1, uint8_t gray)
+{
+    int dx = x1 - x0, dy = y1 - y0, sx = 1, sy = 1, err, start;
+
+    if (dx < 0)
+    {
+        dx = -dx;
+        sx = -1;
+    }
+    if (dy < 0)
+    {
+        dy = -dy;
+        sy = -1;
+    }
+    if (!begin(sx > 0 ? x0 : x1, sy > 0 ? y0 : y1, sx > 0 ? x1 : x0, sy > 0 ? y1 : y0, gray))
+        return;
+
+    if (dx >= dy)
+    {
+        err = dx / 2;
+        start = x0;
+        for (;;)
+        {
+            if (x0 == x1 || (err -= dy) < 0)
+            {
+                if (sx > 0)
+                    hspan(start, x0, y0);
+                else
+                    hspan(x0, start, y0);
+                if (x0 == x1)
+                    break;
+                y0 += sy;
+                err += dx;
+                start = x0 + sx;
+            }
+            x0 += sx;
+        }
+    }
+    else
+    {
+        err = dy / 2;
+        start = y0;
+        for (;;)
+        {
+            if (y0 == y1 || (err -= dx) < 0)
+            {
+                if (sy > 0)
+                    vspan(x0, start, y0);
+                else
+                    vspan(x0, y0, start);
+                if (y0 == y1)
+                    break;
+                x0 += sx;
+                err += dy;
+                start = y0 + sy;
+            }
+            y0 += sy;
+        }
+    }
+    end();
+}
+
+/* outline the circle of radius r around cx,cy */
+void DrawCircle(int cx, int cy, unsigned int r, uint8_t gray)
+{
+    if (!begin(cx - (int)r, cy - (int)r, cx + (int)r, cy + (int)r, gray))
+        return;
+    corners(cx, cy, cx, cy, r, 0);
+    end();
+}
+
+/* fill the circle of radius r around cx,cy */
+void DrawFillCircle(int cx, int cy, unsigned int r, uint8_t gray)
+{
+    if (!begin(cx - (int)r, cy - (int)r, cx + (int)r, cy + (int)r, gray))
+        return;
+    hspan(cx - (int)r, cx + (int)r, cy);
+    corners(cx, cy, cx, cy, r, 1);
+    end();
+}
+
+/* the largest corner radius a w x h rectangle takes */
+static unsigned int cornerRadius(unsigned int w, unsigned int h, unsigned int r)
+{
+    unsigned int most = ((w < h ? w : h) - 1) / 2;
+    return r < most ? r : most;
+}
+
+/* outline the w x h rectangle at x,y with corners rounded to radius r */
+void DrawRoundRect(int x, int y, unsigned int w, unsigned int h, unsigned int r, uint8_t gray)
+{
+    int x1 = x + (int)w - 1, y1 = y + (int)h - 1;
+
+    if (!w || !h || !begin(x, y, x1, y1, gray))
+        return;
+    r = cornerRadius(w, h, r);
+    hspan(x + r, x1 - r, y);
+    hspan(x + r, x1 - r, y1);
+    vspan(x, y + r, y1 - r);
+    vspan(x1, y + r, y1 - r);
+    corners(x + r, y + r, x1 - r, y1 - r, r, 0);
+    end();
+}
+
+/* fill the w x h rectangle at x,y with corners rounded to radius r */
+void DrawFillRoundRect(int x, int y, unsigned int w, unsigned int h, unsigned int r, uint8_t gray)
+{
+    int x1 = x + (int)w - 1, y1 = y + (int)h - 1, row;
+
+    if (!w || !h || !begin(x, y, x1, y1, gray))
+        return;
+    r = cornerRadius(w, h, r);
+    for (row = y + r; row <= y1 - (int)r; ++row)
+        hspan(x, x1, row);
+    corners(x + r, y + r, x1 - r, y1 - r, r, 1);
+    end();
+}
@@ -0,0 +1,64 @@
+/*
+ * Description:
+ *
+ * 2D drawing primitives built from clipped horizontal and vertical spans
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __LCD_DRAW_H__
+#define __LCD_DRAW_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*
+ * Positions are signed so shapes may hang off the glass, everything is clipped
+ * to the clip rectangle. Widths, heights and radii are in pixels, gray is a
+ * controller gray byte as for LCDFillRect().
+ */
+
+/* clip drawing to the w x h rectangle at x,y, and the glass */
+void DrawSetClip(int x, int y, unsigned int w, unsigned int h);
+/* clip drawing to the whole glass */
+void DrawResetClip(void);
+/* set pixel x,y */
+void DrawPixel(int x, int y, uint8_t gray);
+/* draw a horizontal run of w pixels from x,y */
+void DrawHSpan(int x, int y, unsigned int w, uint8_t gray);
+/* draw a vertical run of h pixels down from x,y */
+void DrawVSpan(int x, int y, unsigned int h, uint8_t gray);
+/* fill the w x h rectangle at x,y */
+void DrawFillRect(int x, int y, unsigned int w, unsigned int h, uint8_t gray);
+/* outline the w x h rectangle at x,y, one pixel wide */
+void DrawRect(int x, int y, unsigned int w, unsigned int h, uint8_t gray);
+/* draw a line from x0,y0 to x1,y1, both ends included */
+void DrawLine(int x0, int y0, int x1, int y1, uint8_t gray);
+/* outline the circle of radius r around cx,cy */
+void DrawCircle(int cx, int cy, unsigned int r, uint8_t gray);
+/* fill the circle of radius r around cx,cy */
+void DrawFillCircle(int cx, int cy, unsigned int r, uint8_t gray);
+/* outline the w x h rectangle at x,y with corners rounded to radius r */
+void DrawRoundRect(int x, int y, unsigned int w, unsigned int h, unsigned int r, uint8_t gray);
+/* fill the w x h rectangle at x,y with corners rounded to radius r */
+void DrawFillRoundRect(int x, int y, unsigned int w, unsigned int h, unsigned int r, uint8_t gray);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __LCD_DRAW_H__
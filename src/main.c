@@ -26,7 +26,12 @@
 #include "stm32f10x.h"
 #include "platform_config.h"
 #include "systick.h"
+#include "boot_timeline.h"
+#include "frame_sched.h"
+#include "lcd_bench.h"
 #include "simple_lcd.h"
+#include "text_grid.h"
+#include "terminal.h"
 #include "keys.h"
 #include "leds.h"
 #include "uart.h"
@@ -37,16 +42,26 @@
 #include <string.h>
 #include <unistd.h>
 
+/* Build with TERMINAL_MODE 1 to drive the panel as a VT100 terminal from the USB and
+ * UART streams instead of the demo screen. */
+#ifndef TERMINAL_MODE
+#define TERMINAL_MODE 0
+#endif
+
 /* forward declarations */
 void SetupInterruptVectors(void);
 void SetupSysTick(void);
 
-void ShowKeys(uint16_t key_state, unsigned int y_start);
-void ShowH1UARTData(unsigned int y);
+void ShowLabels(void);
+void ShowKeys(uint16_t key_state, unsigned int row);
+void ShowH1UARTData(unsigned int row);
 void SendKeysToH1UART(uint16_t key_state);
-void ShowUSBData(unsigned int y);
+void ShowUSBData(unsigned int row);
 void SendKeysToUSB(uint16_t key_state);
 void WalkLEDs(unsigned int walk_inc_count);
+void ShowBootTimeline(unsigned int row);
+void SendFrameStatsToUSB(int start);
+void SendBenchToUSB(int start);
 
 
 /* main loop */
@@ -58,10 +73,10 @@ int main(void)
     SetupInterruptVectors();
     SetupSysTick();
 
-    /* Init the LCD */
+    /* Start the LCD bring-up, it completes from the main loop while USB enumerates */
     LCDInit();
     LCDBacklightOn(1);
-    PushBuffer();
+    TextGridInit();
 
     /* light the keys */
     KeyBacklightOn(1);
@@ -79,39 +94,92 @@ int main(void)
     USB_VCOMSetSerialNumberString("1001");
 
     USB_VCOMinit();
+    BootTimelineMark(BOOT_USB_STARTED);
 
-    /* render a banner */
-    RenderString( 10, 0, "CFA-735 User Code");
+#if TERMINAL_MODE
+    TerminalInit();
+#else
+    /* the banner and labels never change, only the values next to them are updated */
+    ShowLabels();
+#endif
 
     /* loop forever doing buffered I/O, walking LEDs, and monitoring the keys */
     while (1)
     {
         uint16_t key_state = ReadKeys();
 
-        ShowUSBData(30);
+#if TERMINAL_MODE
+        /* both streams draw on the one screen, the keys still go out on both */
+        TerminalPoll(USB_VCOMread);
+        SendKeysToUSB(key_state);
+        TerminalPoll(UARTread);
+        SendKeysToH1UART(key_state);
+#else
+        ShowUSBData(3);
         SendKeysToUSB(key_state);
 
-        ShowH1UARTData(40);
+        ShowH1UARTData(4);
         SendKeysToH1UART(key_state);
 
-        ShowKeys(key_state, 50);
+        ShowKeys(key_state, 5);
+        ShowBootTimeline(1);
+
+        SendFrameStatsToUSB(0);
+        SendBenchToUSB(0);
+#endif
 
-        PushBuffer();
+        /* only the text cells that changed are drawn, and the changed regions go out once per frame */
+        TextGridRender(0);
+#if LCD_DOUBLE_BUFFER
+        /* a bitmap upload goes into the back buffer it started in, the frame waits for the rest of it. USB is
+         * held off over the check and the swap, so no upload starts in the buffer that goes to the glass */
+        USB_VCOMHold(1);
+        if (!USB_VCOMUploadPoll())
+            FrameSchedPoll();
+        USB_VCOMHold(0);
+#else
+        /* rows of a bitmap upload that have arrived go out with the rest */
+        USB_VCOMUploadPoll();
+        FrameSchedPoll();
+#endif
         LEDsWalk(10);
     }
 }
 
+/* put the banner and the labels of the values into the text grid */
+void ShowLabels(void)
+{
+    TextGridPutString(0, 0, "CFA-735 User Code", TEXT_ATTR_NORMAL);
+    TextGridPutString(0, 3, " USB: ", TEXT_ATTR_NORMAL);
+    TextGridPutString(0, 4, "UART: ", TEXT_ATTR_NORMAL);
+    TextGridPutString(0, 5, "Keys: ", TEXT_ATTR_NORMAL);
+}
+
+/* show how long the LCD and USB took to come up, once both have */
+void ShowBootTimeline(unsigned int row)
+{
+    static int shown = 0;
+    uint32_t frame = BootTimelineGet(BOOT_FIRST_FRAME);
+    uint32_t usb = BootTimelineGet(BOOT_USB_CONFIGURED);
+
+    if (shown || frame == BOOT_TIME_NONE || usb == BOOT_TIME_NONE)
+        return;
+    shown = 1;
+
+    TextGridPutString(0, row, "Boot LCD", TEXT_ATTR_NORMAL);
+    TextGridPutNumber(9, row, frame, 5);
+    TextGridPutString(15, row, "USB", TEXT_ATTR_NORMAL);
+    TextGridPutNumber(19, row, usb, 5);
+}
+
 /* display the data received on the serial port and scroll it as it comes in */
-void ShowH1UARTData(unsigned int y)
+void ShowH1UARTData(unsigned int row)
 {
     static char characters[21] = {' ',' ',' ',' ',' ',' ',' ',' ',' ',' ', ' ',' ',' ',' ',' ',' ',' ',' ',' ',' ', '\0'};
     char old_chars[20];
     char current_chars[20];
     unsigned int chars_read;
 
-    int x = 10;
-    RenderString(x, y, "UART: ");
-    x += 8 * 6;
     chars_read = UARTread(20, current_chars);
     if (chars_read > 0)
     {
@@ -119,7 +187,7 @@ void ShowH1UARTData(unsigned int y)
         memcpy(characters, old_chars + chars_read, 20 - chars_read);
         memcpy(characters + 20 - chars_read, current_chars, chars_read);
     }
-    RenderString(x, y, characters);
+    TextGridPutString(6, row, characters, TEXT_ATTR_NORMAL);
 }
 
 /* send the names of the keys pressed over the serial port */
@@ -140,24 +208,74 @@ void SendKeysToH1UART(uint16_t key_state)
 }
 
 /* display the data received on the USB port and scroll it as it comes in */
-void ShowUSBData(unsigned int y)
+void ShowUSBData(unsigned int row)
 {
     static char characters[21] = {' ',' ',' ',' ',' ',' ',' ',' ',' ',' ', ' ',' ',' ',' ',' ',' ',' ',' ',' ',' ', '\0'};
     char old_chars[20];
     char current_chars[20];
-    unsigned int chars_read;
+    unsigned int chars_read, i;
 
-    int x = 10;
-    RenderString(x, y, " USB: ");
-    x += 8 * 6;
     chars_read = USB_VCOMread(20, current_chars);
+    /* ctrl-t asks for the frame statistics, ctrl-b runs the benchmarks */
+    for (i = 0; i < chars_read; ++i)
+    {
+        if (current_chars[i] == 0x14)
+            SendFrameStatsToUSB(1);
+        if (current_chars[i] == 0x02)
+            SendBenchToUSB(1);
+    }
     if (chars_read > 0)
     {
         memcpy(old_chars, characters, 20);
         memcpy(characters, old_chars + chars_read, 20 - chars_read);
         memcpy(characters + 20 - chars_read, current_chars, chars_read);
     }
-    RenderString(x, y, characters);
+    TextGridPutString(6, row, characters, TEXT_ATTR_NORMAL);
+}
+
+/* send the frame statistics over the USB port, a line each call once the transmit ring has room for it */
+void SendFrameStatsToUSB(int start)
+{
+    static int line = -1;
+    char buf[FRAME_REPORT_LINE_MAX];
+    unsigned int len;
+
+    if (start)
+        line = 0;
+    /* the ring drains a packet a millisecond and overwrites what it has not sent */
+    if (line < 0 || USB_VCOMwriteFree() < FRAME_REPORT_LINE_MAX)
+        return;
+
+    len = FrameSchedReportLine(line++, buf);
+    if (len)
+        USB_VCOMwrite(len, buf);
+    else
+        line = -1;
+}
+
+/* run the benchmarks and send the results over the USB port, a line each call once the transmit ring has
+ * room for it */
+void SendBenchToUSB(int start)
+{
+    static int line = -1;
+    char buf[LCD_BENCH_LINE_MAX];
+    unsigned int len;
+
+    if (start)
+    {
+        /* the benchmarks draw over the screen, the text goes back on it after */
+        if (LCDBenchRun() >= 0)
+            TextGridInvalidate();
+        line = 0;
+    }
+    if (line < 0 || USB_VCOMwriteFree() < LCD_BENCH_LINE_MAX)
+        return;
+
+    len = LCDBenchReportLine(line++, buf);
+    if (len)
+        USB_VCOMwrite(len, buf);
+    else
+        line = -1;
 }
 
 /* send the names of the keys pressed over the USB port */
@@ -178,22 +296,20 @@ void SendKeysToUSB(uint16_t key_state)
 }
 
 /* Display the keys pressed on the LCD */
-void ShowKeys(uint16_t key_state, unsigned int y_start)
+void ShowKeys(uint16_t key_state, unsigned int row)
 {
-    int x = 10;
-    RenderString(x, y_start, "Keys: ");
-    x += 8 * 6;
-    RenderString(x, y_start, (key_state&KEY_UP_PIN)?"UP ":"   ");
-    x += 8 * 3;
-    RenderString(x, y_start, (key_state&KEY_DOWN_PIN)?"DOWN ":"     ");
-    x += 8 * 5;
-    RenderString(x, y_start, (key_state&KEY_LEFT_PIN)?"LEFT ":"     ");
-    x += 8 * 5;
-    RenderString(x, y_start, (key_state&KEY_RIGHT_PIN)?"RIGHT ":"      ");
-    x = 60;
-    RenderString(x, y_start+10, (key_state&KEY_ENTER_PIN)?"ENTER ":"      ");
-    x += 8 * 6;
-    RenderString(x, y_start+10, (key_state&KEY_CANCEL_PIN)?"CANCEL ":"      ");
+    unsigned int col = 6;
+    TextGridPutString(col, row, (key_state&KEY_UP_PIN)?"UP ":"   ", TEXT_ATTR_NORMAL);
+    col += 3;
+    TextGridPutString(col, row, (key_state&KEY_DOWN_PIN)?"DOWN ":"     ", TEXT_ATTR_NORMAL);
+    col += 5;
+    TextGridPutString(col, row, (key_state&KEY_LEFT_PIN)?"LEFT ":"     ", TEXT_ATTR_NORMAL);
+    col += 5;
+    TextGridPutString(col, row, (key_state&KEY_RIGHT_PIN)?"RIGHT ":"      ", TEXT_ATTR_NORMAL);
+    col = 6;
+    TextGridPutString(col, row+1, (key_state&KEY_ENTER_PIN)?"ENTER ":"      ", TEXT_ATTR_NORMAL);
+    col += 6;
+    TextGridPutString(col, row+1, (key_state&KEY_CANCEL_PIN)?"CANCEL ":"      ", TEXT_ATTR_NORMAL);
 }
 
 /* set the location of the interrupt vector table as in flash and at offset 0 */
@@ -217,6 +333,8 @@ void SetupSysTick(void)
 
     /* Setup a millisecond systick timer */
     mSecSysTickInit(RCC_ClockFreq.SYSCLK_Frequency);
+    /* and the cycle counter for profiling */
+    CycleCounterInit();
 }
 
 /* provide a simple usleep function so a stndard library is not required*/
@@ -23,6 +23,9 @@
 #define __PLATFORM_CONFIG_H
 
 #if defined USE_CFA_735_V0_9
+  /* core clock in MHz, must match the SYSCLK_FREQ_xx selected in system_stm32f10x.c */
+  #define SYSCLK_MHZ                72
+
   #define USB_DISCONNECT            GPIOC
   #define USB_DISCONNECT_CLOCK      RCC_APB2Periph_GPIOC
   #define USB_DISCONNECT_PIN        GPIO_Pin_13
@@ -77,6 +80,15 @@
   #define ST7529_nRST_GPIO        GPIOB
   #define ST7529_nRST_GPIO_CLK    RCC_APB2Periph_GPIOB
 
+  /* ST7529 background push: TIM8_CH1N (PA7) strobes nWR, TIM8 CC3/CC4 requests feed the data lines */
+  #define ST7529_WR_TIM           TIM8
+  #define ST7529_WR_TIM_CLK       RCC_APB2Periph_TIM8
+  #define ST7529_WR_TIM_IRQ       TIM8_UP_IRQn
+  #define ST7529_WR_TIM_HANDLER   TIM8_UP_IRQHandler
+  #define ST7529_WR_DMA_CLK       RCC_AHBPeriph_DMA2
+  #define ST7529_WR_DMA_CLEAR     DMA2_Channel1
+  #define ST7529_WR_DMA_SET       DMA2_Channel2
+
 
   /* Keypad Lines, shared with ST7529 data lines */
   #define KEYS_GPIO            GPIOC
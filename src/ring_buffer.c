@@ -142,3 +142,13 @@ void PutDataInRing(struct RingBuffer* ring, unsigned int size, uint8_t* buffer)
     __enable_irq();
 }
 
+/* safely get the free space of a ring buffer */
+unsigned int GetFreeInRing(const struct RingBuffer* ring)
+{
+    unsigned int used;
+    __disable_irq();
+    used = iGetRemaining(ring);
+    __enable_irq();
+    return RING_SIZE - used;
+}
+
@@ -45,6 +45,8 @@ void InitRing(struct RingBuffer* ring);
 unsigned int GetDataFromRing(struct RingBuffer* ring, unsigned int size, uint8_t* buffer);
 /* put size bytes from buffer into the ring buffer */
 void PutDataInRing(struct RingBuffer* ring, unsigned int size, uint8_t* buffer);
+/* return how many bytes can be put into the ring buffer before the oldest are overwritten */
+unsigned int GetFreeInRing(const struct RingBuffer* ring);
 
 #endif /* __RING_BUFFER_H__ */
 
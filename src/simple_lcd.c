@@ -3,7 +3,10 @@
  *
  * Simple functions for interfacing with the LCD and rendering characters.
  *
- * The LCD is implemented as an 8-bit (1 byte per pixel) framebuffer.
+ * The LCD is implemented as an 8-bit (1 byte per pixel) framebuffer, or as a
+ * packed 4, 2 or 1 bit per pixel framebuffer selected by LCD_FB_BPP in lcd_config.h.
+ * With LCD_FRAMEBUFFER set to 0 there is no framebuffer, drawing goes straight into
+ * the controller's display RAM.
  *
  * License:
  *
@@ -22,43 +25,841 @@
  * limitations under the License.
  */
 #include "st7529_core.h"
+#include "st7529_dma.h"
+#include "boot_timeline.h"
 #include "glassLayout.h"
+#include "lcd_config.h"
 #include "platform_config.h"
 #include "simple_lcd.h"
 #include "stm32f10x.h"
+#include "systick.h"
 #include <string.h>
 #include "08x08fnt.h"
 
 /* table of characters used to represent hex */
 static const char hex_map[16] = {'0','1','2','3','4','5','6','7','8', '9','a','b','c','d','e','f'};
 
-/* the framebuffer memory */
-static uint8_t buffer[LCD_BUFFER_BYTE_CNT];
+/* the font glyph of a character, anything outside the font draws as a space */
+static inline unsigned int glyphIndex(char c)
+{
+    unsigned int i = (unsigned char)c - FONT_08X08_BASE;
+
+    /* below the base wraps high, char may be signed or not */
+    return i < FONT_08X08_COUNT ? i : ' ' - FONT_08X08_BASE;
+}
+
+#if LCD_FRAMEBUFFER
+#if LCD_DOUBLE_BUFFER
+/* the framebuffer memory, word aligned so rows can be fed to the CRC unit */
+static uint8_t buffers[2][LCD_FB_BYTE_CNT] __attribute__((aligned(4)));
+/* drawing goes into the back buffer, pushes read the front one */
+static uint8_t* buffer = buffers[0];
+static uint8_t* front = buffers[1];
+static struct LCDSwapStats swap_stats;
+/* core cycle count when a present was first turned away by a push in flight */
+static uint32_t present_wait_start;
+static int present_waiting = 0;
+#else
+/* the framebuffer memory, word aligned so rows can be fed to the CRC unit */
+static uint8_t buffer[LCD_FB_BYTE_CNT] __attribute__((aligned(4)));
+/* with a single buffer, pushes read the buffer being drawn into */
+static uint8_t* const front = buffer;
+#endif
+
+#if LCD_FB_BPP != 8
+/* gray bytes for 16 evenly spaced levels, packed levels index it in steps of 15 / (levels - 1) */
+static const uint8_t gray16[16] = {
+    0x00, 0x10, 0x20, 0x30, 0x40, 0x54, 0x64, 0x74,
+    0x84, 0x94, 0xa8, 0xb8, 0xc8, 0xd8, 0xe8, 0xfc
+};
+#define LEVEL_TO_GRAY(LEVEL)    (gray16[(LEVEL) * (15 / (LCD_FB_LEVELS - 1))])
+#define LEVEL_MASK              (LCD_FB_LEVELS - 1)
+
+/* a row of expanded gray bytes for the push */
+static uint8_t row_gray[LCD_USABLE_PIXELS_PER_ROW];
+#endif
+
+/* the packed level of a gray value */
+#define GRAY_TO_LEVEL(GRAY)     ((uint8_t)(GRAY) >> (8 - LCD_FB_BPP))
+
+#if LCD_FB_BPP == 1
+/* bit-band alias word of a 1bpp pixel, bit 7 of each byte is the leftmost pixel */
+#define PIXEL_BIT_BAND(X, Y) (*(volatile uint32_t*)(SRAM_BB_BASE \
+    + (((uint32_t)&buffer[(Y) * LCD_FB_STRIDE + ((X) >> 3)] - SRAM_BASE) << 5) + ((7 - ((X) & 7)) << 2)))
+#endif
+
+/* row hashing: CRC of every row as it was last pushed */
+#define LCD_ROW_WORDS (LCD_FB_STRIDE / 4)
+static uint32_t row_crc[LCD_LINES];
+static int row_hashing = 0;
+static int row_crc_valid = 0;
+static struct LCDRowHashStats row_hash_stats;
+
+/* the regions of the framebuffer changed since the last push, inclusive pixel bounds */
+struct DirtyRect
+{
+    uint16_t x0, y0, x1, y1;
+};
+
+/* at most this many windows are sent per push, more damage gets merged */
+#define LCD_DIRTY_RECTS         4
+/* approximate bus cost of addressing a window, in pixel writes */
+#define LCD_WINDOW_COST         16
+
+static struct DirtyRect dirty[LCD_DIRTY_RECTS];
+static unsigned int dirty_count = 0;
+
+/* function define for a glyph render, invert flips the glyph's pixels, returns non-zero if any pixel changed */
+static int Render(unsigned int c, unsigned int x, unsigned int y, uint8_t invert);
+static void buildGlyphCache(void);
+
+#if LCD_FB_BPP != 8
+/* read the packed level of pixel x,y */
+static inline unsigned int getLevel(unsigned int x, unsigned int y)
+{
+#if LCD_FB_BPP == 1
+    return PIXEL_BIT_BAND(x, y);
+#else
+    unsigned int shift = (LCD_FB_PIXELS_PER_BYTE - 1 - x % LCD_FB_PIXELS_PER_BYTE) * LCD_FB_BPP;
+    return (buffer[y * LCD_FB_STRIDE + x / LCD_FB_PIXELS_PER_BYTE] >> shift) & LEVEL_MASK;
+#endif
+}
+
+/* write the packed level of pixel x,y */
+static inline void setLevel(unsigned int x, unsigned int y, unsigned int level)
+{
+#if LCD_FB_BPP == 1
+    PIXEL_BIT_BAND(x, y) = level;
+#else
+    unsigned int shift = (LCD_FB_PIXELS_PER_BYTE - 1 - x % LCD_FB_PIXELS_PER_BYTE) * LCD_FB_BPP;
+    uint8_t* b = &buffer[y * LCD_FB_STRIDE + x / LCD_FB_PIXELS_PER_BYTE];
+    *b = (*b & ~(LEVEL_MASK << shift)) | (level << shift);
+#endif
+}
+
+/* expand count packed pixels of a row to the controller's gray bytes */
+static const uint8_t* packedRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    const uint8_t* src = &front[row * LCD_FB_STRIDE + first / LCD_FB_PIXELS_PER_BYTE];
+    unsigned int shift = (LCD_FB_PIXELS_PER_BYTE - 1 - first % LCD_FB_PIXELS_PER_BYTE) * LCD_FB_BPP;
+    uint8_t* out = row_gray;
+    uint8_t bits = *src++;
+
+    while (count--)
+    {
+        *out++ = LEVEL_TO_GRAY((bits >> shift) & LEVEL_MASK);
+        if (shift)
+        {
+            shift -= LCD_FB_BPP;
+        }
+        else if (count)
+        {
+            shift = 8 - LCD_FB_BPP;
+            bits = *src++;
+        }
+    }
+    return row_gray;
+}
+#define pushRect(X0, Y0, X1, Y1) ST7529_rectToLCDFrom(packedRow, X0, Y0, X1, Y1)
+#else
+#define pushRect(X0, Y0, X1, Y1) ST7529_rectToLCD(front, X0, Y0, X1, Y1)
+#endif
+#else
+/* a row of gray bytes handed to the controller by the row sources below */
+static uint8_t span[LCD_USABLE_PIXELS_PER_ROW];
+
+/* what the row sources are drawing */
+static struct
+{
+    unsigned int x, y, w;
+    const uint8_t* pixels;
+    const char* string;
+    uint8_t invert;
+} draw;
+
+/* row source for a fill, every row is the span */
+static const uint8_t* fillRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    return span;
+}
+
+/* row source for a blit */
+static const uint8_t* blitRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    return draw.pixels + (row - draw.y) * draw.w + first - draw.x;
+}
 
-/* function define for a 8x8 bitmap (1 bit/pixel) render, used for characters */
-static void Render(const uint8_t bitmap[8], unsigned int x, unsigned int y);
+/* row source for a string, the glyph bits are looked up as the row goes out */
+static const uint8_t* textRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    unsigned int i, bit = row - draw.y;
+
+    for (i = 0; i < count; ++i)
+    {
+        unsigned int x = first + i - draw.x;
+        span[i] = ((Font_08x08[glyphIndex(draw.string[x / 8])][x % 8] >> bit) & 1) ^ draw.invert ? BLACK : WHITE;
+    }
+    return span;
+}
+#endif
 
-/* itialize the controller and display */
+/* start the controller bring-up, LCDPoll() runs it to completion */
 void LCDInit(void)
 {
-    ST7529_init();
+    ST7529_initStart();
+#if LCD_FRAMEBUFFER
+    ST7529_dmaInit();
+    buildGlyphCache();
+    LCDClear();
+#endif
+}
+
+/* run the controller bring-up and background jobs, returns non-zero while the LCD is not ready for pixels */
+int LCDPoll(void)
+{
+    static int lcd_up = 0;
+
+    /* a background push owns the bus, command sequences resume once it completes */
+    if (ST7529_dmaBusy())
+        return ST7529_busy();
+    /* a command sequence owns the controller, pixel data would be taken as commands */
+    if (ST7529_poll())
+        return 1;
+    if (lcd_up)
+        return 0;
+    if (!ST7529_ready())
+        return 1;
+
+    lcd_up = 1;
     ST7529_writeContrast(LCD_CONTRAST_OPT);
+    /* run the pixel streams as fast as this unit allows */
+    ST7529_calibrateBus();
+    BootTimelineMark(BOOT_LCD_READY);
+#if !LCD_FRAMEBUFFER
+    /* the display RAM holds noise after power up */
     LCDClear();
+    BootTimelineMark(BOOT_FIRST_FRAME);
+#endif
+    return 0;
 }
 
-/* clear the frame buffer */
+/* clear the frame buffer, WHITE is all zero bits in every format */
 void LCDClear(void)
 {
-    memset(buffer, WHITE, sizeof(buffer));
+#if LCD_FRAMEBUFFER
+    memset(buffer, WHITE, LCD_FB_BYTE_CNT);
+    LCDMarkDirty(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES);
+#else
+    LCDFillRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, WHITE);
+#endif
 }
 
-/* push the frame buffer to the controller */
-void PushBuffer(void)
+/* clip a w x h rectangle at x,y to the glass, returns 0 if nothing is left */
+static int clipRect(unsigned int x, unsigned int y, unsigned int* w, unsigned int* h)
+{
+    if (!*w || !*h || x >= LCD_USABLE_PIXELS_PER_ROW || y >= LCD_LINES)
+        return 0;
+    if (x + *w > LCD_USABLE_PIXELS_PER_ROW)
+        *w = LCD_USABLE_PIXELS_PER_ROW - x;
+    if (y + *h > LCD_LINES)
+        *h = LCD_LINES - y;
+    return 1;
+}
+
+#if LCD_FRAMEBUFFER
+
+/* bus cost of pushing a rectangle, widened to whole controller columns */
+static unsigned int rectCost(const struct DirtyRect* r)
+{
+    unsigned int cols = (r->x1 + LCD_UNMAPPED_LINES) / LCD_PIXELS_PER_COLUMN
+                        - (r->x0 + LCD_UNMAPPED_LINES) / LCD_PIXELS_PER_COLUMN + 1;
+    return LCD_WINDOW_COST + cols * LCD_BYTES_PER_COLUMN * (r->y1 - r->y0 + 1);
+}
+
+/* the bounding rectangle of a and b */
+static struct DirtyRect rectUnion(const struct DirtyRect* a, const struct DirtyRect* b)
 {
+    struct DirtyRect u;
+    u.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+    u.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+    u.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+    u.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+    return u;
+}
+
+/* record a changed region of the framebuffer */
+void LCDMarkDirty(unsigned int x, unsigned int y, unsigned int w, unsigned int h)
+{
+    struct DirtyRect r;
+    unsigned int i, best = 0, best_growth = ~0u;
+
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    r.x0 = x;
+    r.y0 = y;
+    r.x1 = x + w - 1;
+    r.y1 = y + h - 1;
+
+    /* fold in every window that is cheaper to send together with this one */
+    i = 0;
+    while (i < dirty_count)
+    {
+        struct DirtyRect u = rectUnion(&r, &dirty[i]);
+        if (rectCost(&u) <= rectCost(&r) + rectCost(&dirty[i]))
+        {
+            r = u;
+            dirty[i] = dirty[--dirty_count];
+            i = 0;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    if (dirty_count < LCD_DIRTY_RECTS)
+    {
+        dirty[dirty_count++] = r;
+        return;
+    }
+
+    /* out of windows, grow the one that costs the least extra */
+    for (i = 0; i < dirty_count; ++i)
+    {
+        struct DirtyRect u = rectUnion(&r, &dirty[i]);
+        unsigned int growth = rectCost(&u) - rectCost(&dirty[i]);
+        if (growth < best_growth)
+        {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    dirty[best] = rectUnion(&r, &dirty[best]);
+}
+
+/* check for changes not yet pushed to the controller */
+int LCDIsDirty(void)
+{
+    /* with row hashing, direct framebuffer writes are only found by the push */
+    return dirty_count != 0 || row_hashing;
+}
+
+/* give out the framebuffer for code that draws into it directly */
+uint8_t* LCDGetFramebuffer(void)
+{
+    return buffer;
+}
+
+/* enable / disable finding the changed rows by hashing at push time */
+void LCDSetRowHashing(int onoff)
+{
+    if (onoff && !row_hashing)
+    {
+        RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+        /* nothing is known about what the glass shows yet */
+        row_crc_valid = 0;
+    }
+    row_hashing = onoff;
+}
+
+/* copy out the row hashing counters */
+void LCDGetRowHashStats(struct LCDRowHashStats* stats)
+{
+    *stats = row_hash_stats;
+}
+
+/* push the runs of rows whose CRC differs from the last push */
+static void pushChangedRows(void)
+{
+    unsigned int row, run_start = 0;
+    int in_run = 0;
+    uint32_t start = getCycleCount();
+    uint32_t hash_cycles = 0;
+
+    for (row = 0; row <= LCD_LINES; ++row)
+    {
+        int changed = 0;
+
+        if (row < LCD_LINES)
+        {
+            uint32_t crc;
+            uint32_t t = getCycleCount();
+            CRC_ResetDR();
+            crc = CRC_CalcBlockCRC((uint32_t*)(void*)(front + row * LCD_FB_STRIDE), LCD_ROW_WORDS);
+            hash_cycles += getCycleCount() - t;
+
+            changed = !row_crc_valid || crc != row_crc[row];
+            row_crc[row] = crc;
+        }
+
+        if (changed && !in_run)
+        {
+            run_start = row;
+            in_run = 1;
+        }
+        else if (!changed && in_run)
+        {
+            pushRect(0, run_start, LCD_USABLE_PIXELS_PER_ROW - 1, row - 1);
+            row_hash_stats.rows_pushed += row - run_start;
+            in_run = 0;
+        }
+    }
+
+    row_crc_valid = 1;
+    row_hash_stats.pushes++;
+    row_hash_stats.rows_hashed += LCD_LINES;
+    row_hash_stats.hash_cycles += hash_cycles;
+    row_hash_stats.push_cycles += getCycleCount() - start - hash_cycles;
+}
+
+/* push the changed regions of the front buffer to the controller */
+static void pushDamage(void)
+{
+    unsigned int i;
+
+    if (row_hashing)
+    {
+        /* the hashes find everything the dirty rectangles would */
+        dirty_count = 0;
+        ST7529_busInit();
+        pushChangedRows();
+        BootTimelineMark(BOOT_FIRST_FRAME);
+        return;
+    }
+
+    if (!dirty_count)
+        return;
+
     /* as this bus is shared with the keys, we take it every push*/
     ST7529_busInit();
-    /* push the buffer */
-    ST7529_bufferToLCD(buffer);
+    /* push the damaged windows only */
+    for (i = 0; i < dirty_count; ++i)
+        pushRect(dirty[i].x0, dirty[i].y0, dirty[i].x1, dirty[i].y1);
+    dirty_count = 0;
+    BootTimelineMark(BOOT_FIRST_FRAME);
+}
+
+#if LCD_DOUBLE_BUFFER
+/* copy what changed in the frame just swapped to the front into the new back buffer, so both hold it */
+static void copyBack(void)
+{
+    unsigned int i, row;
+
+    if (row_hashing)
+    {
+        /* direct writes leave no damage behind, so all of it goes */
+        memcpy(buffer, front, LCD_FB_BYTE_CNT);
+        return;
+    }
+
+    for (i = 0; i < dirty_count; ++i)
+    {
+        unsigned int first = dirty[i].x0 / LCD_FB_PIXELS_PER_BYTE;
+        unsigned int count = dirty[i].x1 / LCD_FB_PIXELS_PER_BYTE - first + 1;
+
+        for (row = dirty[i].y0; row <= dirty[i].y1; ++row)
+            memcpy(&buffer[row * LCD_FB_STRIDE + first], &front[row * LCD_FB_STRIDE + first], count);
+    }
+}
+
+/* swap the back buffer to the front and start pushing it, returns -1 while a push is still in
+ * flight, 0 if nothing changed or 1 once presented */
+static int present(void (*done)(void))
+{
+    uint8_t* drawn;
+    uint32_t now = getCycleCount();
+    uint32_t wait;
+
+    if (LCDPoll() || ST7529_dmaBusy())
+    {
+        /* the latency runs from the first present turned away */
+        if (!present_waiting)
+        {
+            present_waiting = 1;
+            present_wait_start = now;
+        }
+        swap_stats.deferred++;
+        return -1;
+    }
+
+    if (!LCDIsDirty())
+    {
+        present_waiting = 0;
+        if (done)
+            done();
+        return 0;
+    }
+
+    /* nothing reads the front buffer between pushes, so the swap is just the two pointers */
+    drawn = buffer;
+    buffer = front;
+    front = drawn;
+
+    wait = present_waiting ? now - present_wait_start : 0;
+    present_waiting = 0;
+    swap_stats.swaps++;
+    swap_stats.wait_cycles += wait;
+    if (wait > swap_stats.wait_cycles_max)
+        swap_stats.wait_cycles_max = wait;
+
+    copyBack();
+    swap_stats.copy_cycles += getCycleCount() - now;
+
+#if LCD_PUSH_DMA_CAPABLE
+    /* the background push windows assume the display RAM is not scrolled */
+    if (!ST7529_isScrolled())
+    {
+        /* the background push always sends the whole frame */
+        dirty_count = 0;
+        /* the row hashes no longer say what the glass shows */
+        row_crc_valid = 0;
+        ST7529_busInit();
+        BootTimelineMark(BOOT_FIRST_FRAME);
+        ST7529_dmaStartPush(front, done);
+        return 1;
+    }
+#endif
+    /* packed pixels and columns are built by the CPU, so the push completes before returning */
+    pushDamage();
+    if (done)
+        done();
+    return 1;
+}
+
+/* push the changed regions of the frame buffer to the controller, waiting for it to go out */
+void PushBuffer(void)
+{
+    /* nothing goes out until the controller is up, the damage is kept until then */
+    if (LCDPoll())
+        return;
+
+    /* let any background push finish first */
+    while (ST7529_dmaBusy()) ;
+    present(0);
+    while (ST7529_dmaBusy()) ;
+}
+
+/* swap the buffers and start pushing the frame drawn, the back buffer can be drawn into straight away */
+int LCDPresent(void)
+{
+    return present(0);
+}
+
+/* start pushing the frame buffer to the controller in the background */
+int PushBufferAsync(void (*done)(void))
+{
+    return present(done) < 0 ? -1 : 0;
+}
+#else
+/* push the changed regions of the frame buffer to the controller */
+void PushBuffer(void)
+{
+    /* nothing goes out until the controller is up, the damage is kept until then */
+    if (LCDPoll())
+        return;
+
+    /* let any background push finish first */
+    while (ST7529_dmaBusy()) ;
+    pushDamage();
+}
+
+/* with one buffer presenting is a push, drawing waits for it */
+int LCDPresent(void)
+{
+    if (LCDPoll())
+        return -1;
+    if (!LCDIsDirty())
+        return 0;
+    PushBuffer();
+    return 1;
+}
+
+/* start pushing the frame buffer to the controller in the background */
+int PushBufferAsync(void (*done)(void))
+{
+#if LCD_PUSH_DMA_CAPABLE
+    /* the background push windows assume the display RAM is not scrolled */
+    if (!ST7529_isScrolled())
+    {
+        if (LCDPoll() || ST7529_dmaBusy())
+            return -1;
+        /* the background push always sends the whole frame */
+        dirty_count = 0;
+        /* the row hashes no longer say what the glass shows */
+        row_crc_valid = 0;
+        /* as this bus is shared with the keys, we take it every push*/
+        ST7529_busInit();
+        return ST7529_dmaStartPush(buffer, done);
+    }
+#endif
+    /* packed pixels and columns are built by the CPU, so the push completes before returning */
+    PushBuffer();
+    if (done)
+        done();
+    return 0;
+}
+#endif
+
+/* check for a background push still owning the LCD bus */
+int PushBusy(void)
+{
+    return ST7529_dmaBusy();
+}
+
+/* fill a w x h rectangle at x,y with a gray value */
+void LCDFillRect(unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint8_t gray)
+{
+    unsigned int row;
+
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    for (row = y; row < y + h; ++row)
+    {
+#if LCD_FB_BPP == 8
+        memset(&buffer[row * LCD_FB_STRIDE + x], gray, w);
+#else
+        unsigned int col;
+        for (col = x; col < x + w; ++col)
+            setLevel(col, row, GRAY_TO_LEVEL(gray));
+#endif
+    }
+    LCDMarkDirty(x, y, w, h);
+}
+
+/* copy a w x h block of gray bytes, w bytes per row, to x,y */
+void LCDBlit(unsigned int x, unsigned int y, unsigned int w, unsigned int h, const uint8_t* pixels)
+{
+    unsigned int row, stride = w;
+
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    for (row = y; row < y + h; ++row)
+    {
+#if LCD_FB_BPP == 8
+        memcpy(&buffer[row * LCD_FB_STRIDE + x], pixels, w);
+#else
+        unsigned int col;
+        for (col = x; col < x + w; ++col)
+            setLevel(col, row, GRAY_TO_LEVEL(pixels[col - x]));
+#endif
+        pixels += stride;
+    }
+    LCDMarkDirty(x, y, w, h);
+}
+#else
+/* nothing is held back without a framebuffer */
+void LCDMarkDirty(unsigned int x, unsigned int y, unsigned int w, unsigned int h)
+{
+}
+
+/* the display RAM is always up to date */
+int LCDIsDirty(void)
+{
+    return 0;
+}
+
+/* there is no framebuffer to draw into */
+uint8_t* LCDGetFramebuffer(void)
+{
+    return 0;
+}
+
+/* row hashing needs a framebuffer to hash */
+void LCDSetRowHashing(int onoff)
+{
+}
+
+/* no pushes, no counters */
+void LCDGetRowHashStats(struct LCDRowHashStats* stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+/* everything was drawn straight into the display RAM already */
+void PushBuffer(void)
+{
+}
+
+/* there is never a frame to present */
+int LCDPresent(void)
+{
+    return 0;
+}
+
+/* nothing to push, done right away */
+int PushBufferAsync(void (*done)(void))
+{
+    if (done)
+        done();
+    return 0;
+}
+
+/* no push is ever in flight */
+int PushBusy(void)
+{
+    return 0;
+}
+
+/* drawing straight into display RAM has to wait for the controller bring-up and jobs */
+static void waitReady(void)
+{
+    while (LCDPoll()) ;
+}
+
+/* fill a w x h rectangle at x,y with a gray value, straight into display RAM */
+void LCDFillRect(unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint8_t gray)
+{
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    waitReady();
+    memset(span, gray, w);
+    /* as this bus is shared with the keys, we take it every draw */
+    ST7529_busInit();
+    ST7529_rectMergeToLCD(fillRow, x, y, x + w - 1, y + h - 1);
+}
+
+/* copy a w x h block of gray bytes, w bytes per row, to x,y straight into display RAM */
+void LCDBlit(unsigned int x, unsigned int y, unsigned int w, unsigned int h, const uint8_t* pixels)
+{
+    draw.w = w;
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    waitReady();
+    draw.x = x;
+    draw.y = y;
+    draw.pixels = pixels;
+    ST7529_busInit();
+    ST7529_rectMergeToLCD(blitRow, x, y, x + w - 1, y + h - 1);
+}
+#endif
+
+/* copy out the buffer swap counters, all zero with a single buffer */
+void LCDGetSwapStats(struct LCDSwapStats* stats)
+{
+#if LCD_DOUBLE_BUFFER
+    *stats = swap_stats;
+#else
+    memset(stats, 0, sizeof(*stats));
+#endif
+}
+
+/* the rows currently set up as the controller's scroll area */
+static unsigned int scroll_top = 0, scroll_rows = 0;
+
+/* check if the controller can scroll rows y..y+h-1 by shift rows, setting its scroll area up if needed */
+static int hardwareScroll(unsigned int y, unsigned int h, unsigned int shift)
+{
+    if (shift % 4 || !ST7529_scrollAreaValid(y, h) || LCDPoll() || PushBusy())
+        return 0;
+
+#if LCD_FRAMEBUFFER
+    /* the display RAM has to be up to date before it is moved */
+    PushBuffer();
+#endif
+    ST7529_busInit();
+    if (scroll_rows != h || scroll_top != y)
+    {
+#if LCD_FRAMEBUFFER
+        /* the old area goes back to unscrolled, its rows are rewritten. The row hashes no longer
+         * describe what those rows show, and a hashing push would skip them */
+        if (scroll_rows && ST7529_isScrolled())
+        {
+            LCDMarkDirty(0, scroll_top, LCD_USABLE_PIXELS_PER_ROW, scroll_rows);
+            row_crc_valid = 0;
+        }
+#endif
+        ST7529_scrollArea(y, h);
+        scroll_top = y;
+        scroll_rows = h;
+    }
+    return 1;
+}
+
+#if LCD_FRAMEBUFFER
+/* move framebuffer row from to row to, in both buffers when the controller moved the glass */
+static void moveRow(unsigned int to, unsigned int from, int hw)
+{
+    memcpy(&buffer[to * LCD_FB_STRIDE], &buffer[from * LCD_FB_STRIDE], LCD_FB_STRIDE);
+#if LCD_DOUBLE_BUFFER
+    /* the front buffer is idle after the flush and has to keep matching the glass,
+     * a redraw marks the region dirty so the next swap copies it back instead */
+    if (hw)
+        memcpy(&front[to * LCD_FB_STRIDE], &front[from * LCD_FB_STRIDE], LCD_FB_STRIDE);
+#endif
+}
+
+/* reverse the order of the row hashes of rows first..last */
+static void reverseRowHashes(unsigned int first, unsigned int last)
+{
+    while (first < last)
+    {
+        uint32_t crc = row_crc[first];
+        row_crc[first++] = row_crc[last];
+        row_crc[last--] = crc;
+    }
+}
+
+/* rotate the row hashes of rows y..y+h-1 up by n rows, as the controller rotates what the glass shows:
+ * the rows scrolled in show the ones that left until they are rewritten */
+static void rotateRowHashes(unsigned int y, unsigned int h, unsigned int n)
+{
+    reverseRowHashes(y, y + n - 1);
+    reverseRowHashes(y + n, y + h - 1);
+    reverseRowHashes(y, y + h - 1);
+}
+#endif
+
+/* scroll rows y..y+h-1 up by n rows (down if n is negative), the rows scrolled in are cleared */
+int LCDScrollRegion(unsigned int y, unsigned int h, int n)
+{
+    unsigned int shift = n < 0 ? -n : n;
+#if LCD_FRAMEBUFFER
+    unsigned int row;
+#endif
+    int hw;
+
+    if (!h || !shift || y >= LCD_LINES)
+        return -1;
+    if (y + h > LCD_LINES)
+        h = LCD_LINES - y;
+    if (shift >= h)
+    {
+        LCDFillRect(0, y, LCD_USABLE_PIXELS_PER_ROW, h, WHITE);
+        return 0;
+    }
+
+    hw = hardwareScroll(y, h, shift);
+    if (hw)
+        ST7529_scrollBy(n);
+#if !LCD_FRAMEBUFFER
+    else
+        return -1;
+#else
+    /* the framebuffer follows what the glass shows, and the row hashes what is on it */
+    if (hw)
+        rotateRowHashes(y, h, n > 0 ? shift : h - shift);
+    if (n > 0)
+    {
+        for (row = y; row < y + h - shift; ++row)
+            moveRow(row, row + shift, hw);
+    }
+    else
+    {
+        for (row = y + h - 1; row >= y + shift; --row)
+            moveRow(row, row - shift, hw);
+    }
+    if (!hw)
+        LCDMarkDirty(0, y, LCD_USABLE_PIXELS_PER_ROW, h);
+#endif
+
+    /* the rows scrolled in */
+    LCDFillRect(0, n > 0 ? y + h - shift : y, LCD_USABLE_PIXELS_PER_ROW, shift, WHITE);
+    return hw;
 }
 
 /* enable disable the backlight */
@@ -103,53 +904,196 @@ void RenderNumber(unsigned int x, unsigned int y, uint32_t num)
     RenderString(x, y, &s[i]);
 }
 
+#if LCD_FRAMEBUFFER
 /* render a c string at x,y */
 void RenderString(unsigned int x, unsigned int y, const char* string)
 {
-    while (*string != '\0')
-    {
-        char c = *string;
-        if (c < FONT_08X08_BASE || c > 148)
-            c = ' ';
+    unsigned int changed_x0 = ~0u, changed_x1 = 0;
 
-        Render( Font_08x08[(unsigned int)c - FONT_08X08_BASE], x, y);
+    /* glyphs are only drawn where they fit entirely on the glass, and at least their top row */
+    if (y >= LCD_LINES)
+        return;
+    while (*string != '\0' && x + 8 <= LCD_USABLE_PIXELS_PER_ROW)
+    {
+        if (Render(glyphIndex(*string), x, y, 0))
+        {
+            if (changed_x0 == ~0u)
+                changed_x0 = x;
+            changed_x1 = x + 8;
+        }
 
         x+=8;
         ++string;
     }
+
+    /* redrawing identical text leaves nothing to push */
+    if (changed_x0 != ~0u)
+        LCDMarkDirty(changed_x0, y, changed_x1 - changed_x0, 8);
+}
+
+/* render one character at x,y, black on white or inverted */
+void RenderGlyph(unsigned int x, unsigned int y, char c, int inverse)
+{
+    /* glyphs are only drawn where they fit entirely on the glass */
+    if (x + 8 > LCD_USABLE_PIXELS_PER_ROW || y >= LCD_LINES)
+        return;
+    if (Render(glyphIndex(c), x, y, inverse ? 0xff : 0))
+        LCDMarkDirty(x, y, 8, 8);
+}
+#else
+/* render a c string at x,y straight into display RAM, one window for the whole string */
+void RenderString(unsigned int x, unsigned int y, const char* string)
+{
+    unsigned int w = 0, h = 8;
+
+    /* glyphs are only drawn where they fit entirely on the glass */
+    while (string[w / 8] != '\0' && x + w + 8 <= LCD_USABLE_PIXELS_PER_ROW)
+        w += 8;
+    if (!clipRect(x, y, &w, &h))
+        return;
+
+    waitReady();
+    draw.x = x;
+    draw.y = y;
+    draw.string = string;
+    draw.invert = 0;
+    ST7529_busInit();
+    ST7529_rectMergeToLCD(textRow, x, y, x + w - 1, y + h - 1);
 }
 
-/* render an 8x8 bitmap (a character in 1bpp) at x,y */
-static void Render(const uint8_t bitmap[8], unsigned int x, unsigned int y)
+/* render one character at x,y straight into display RAM, black on white or inverted */
+void RenderGlyph(unsigned int x, unsigned int y, char c, int inverse)
 {
-    uint8_t* fb = buffer + (y * LCD_USABLE_PIXELS_PER_ROW + x);
+    char string[2];
+    unsigned int w = 8, h = 8;
+
+    if (x + 8 > LCD_USABLE_PIXELS_PER_ROW || !clipRect(x, y, &w, &h))
+        return;
 
-    unsigned int top, bottom;
-    unsigned int left, right;
+    string[0] = c;
+    string[1] = '\0';
+    waitReady();
+    draw.x = x;
+    draw.y = y;
+    draw.string = string;
+    draw.invert = inverse ? 1 : 0;
+    ST7529_busInit();
+    ST7529_rectMergeToLCD(textRow, x, y, x + w - 1, y + h - 1);
+}
+#endif
 
-    top = 8;
-    bottom = 0;
+#if LCD_FRAMEBUFFER
+/* the font turned to rows of pixels, bit 7 of each row is the leftmost pixel */
+static uint8_t glyph_rows[FONT_08X08_COUNT][8];
 
-    do
+#if LCD_FB_BPP == 8
+/* four pixels of a glyph row (a nibble, MSB leftmost) as four gray bytes in memory order */
+static uint32_t nibble_pixels[16];
+/* a word store that may be unaligned, the core splits it up */
+typedef struct { uint32_t word; } __attribute__((packed)) unaligned_word_t;
+#else
+/* four pixels of a glyph row (a nibble, MSB leftmost) as four packed levels, MSB leftmost */
+static uint16_t nibble_pixels[16];
+#endif
+
+/* transpose the font to rows and fill the nibble expansion table */
+static void buildGlyphCache(void)
+{
+    unsigned int c, row, col, n;
+
+    for (c = 0; c < FONT_08X08_COUNT; ++c)
     {
-        --top;
-        left = 0;
-        right = 8;
+        for (row = 0; row < 8; ++row)
+        {
+            uint8_t bits = 0;
+            for (col = 0; col < 8; ++col)
+                bits |= ((Font_08x08[c][col] >> row) & 1) << (7 - col);
+            glyph_rows[c][row] = bits;
+        }
+    }
 
-        do
+    for (n = 0; n < 16; ++n)
+    {
+        nibble_pixels[n] = 0;
+        for (col = 0; col < 4; ++col)
         {
-            uint8_t val;
-            val = (bitmap[left]<<top);
-            val &= 0x80;
+            if (!(n & (8 >> col)))
+                continue;
+#if LCD_FB_BPP == 8
+            nibble_pixels[n] |= (uint32_t)0xff << (col * 8);
+#else
+            nibble_pixels[n] |= GRAY_TO_LEVEL(BLACK) << ((3 - col) * LCD_FB_BPP);
+#endif
+        }
+    }
+}
 
-            if (fb >= &(buffer[LCD_BUFFER_BYTE_CNT]))
-                return;
-            *fb = val?0xff:0x00;
-            fb++;
+#if LCD_FB_BPP == 8
+/* render glyph c at x,y with its rows xored with invert, the glyph has to fit across, returns non-zero if any pixel changed */
+static int Render(unsigned int c, unsigned int x, unsigned int y, uint8_t invert)
+{
+    unaligned_word_t* fb = (unaligned_word_t*)(buffer + y * LCD_FB_STRIDE + x);
+    const uint8_t* rows = glyph_rows[c];
+    unsigned int row, height = LCD_LINES - y < 8 ? LCD_LINES - y : 8;
+    uint32_t changed = 0;
 
-            ++left;
-        } while (left != right);
-        fb += LCD_USABLE_PIXELS_PER_ROW - 8;
+    /* the height below is unsigned, off the bottom it would wrap to a whole glyph */
+    if (y >= LCD_LINES)
+        return 0;
 
-    } while (top != bottom);
+    for (row = 0; row < height; ++row)
+    {
+        uint8_t bits = rows[row] ^ invert;
+        uint32_t left = nibble_pixels[bits >> 4];
+        uint32_t right = nibble_pixels[bits & 0xf];
+
+        changed |= (fb[0].word ^ left) | (fb[1].word ^ right);
+        fb[0].word = left;
+        fb[1].word = right;
+        fb += LCD_FB_STRIDE / 4;
+    }
+    return changed != 0;
+}
+#else
+/* render glyph c at x,y into the packed framebuffer with its rows xored with invert, the glyph has to fit across,
+ * returns non-zero if any pixel changed */
+static int Render(unsigned int c, unsigned int x, unsigned int y, uint8_t invert)
+{
+    const uint8_t* rows = glyph_rows[c];
+    unsigned int row, half, i, height = LCD_LINES - y < 8 ? LCD_LINES - y : 8;
+    uint8_t changed = 0;
+
+    /* the height below is unsigned, off the bottom it would wrap to a whole glyph */
+    if (y >= LCD_LINES)
+        return 0;
+
+    /* each half of a glyph row is 4 * LCD_FB_BPP bits starting shift bits into its first byte,
+     * lined up at the top of a word so the bytes come off it from the top down */
+    for (half = 0; half < 2; ++half)
+    {
+        unsigned int px = x + half * 4;
+        unsigned int shift = (px * LCD_FB_BPP) % 8;
+        unsigned int bytes = (shift + 4 * LCD_FB_BPP + 7) / 8;
+        unsigned int top = 32 - 4 * LCD_FB_BPP - shift;
+        uint32_t mask = ((1u << (4 * LCD_FB_BPP)) - 1) << top;
+        uint8_t* fb = buffer + y * LCD_FB_STRIDE + px * LCD_FB_BPP / 8;
+
+        for (row = 0; row < height; ++row)
+        {
+            uint8_t glyph = rows[row] ^ invert;
+            uint32_t bits = (uint32_t)nibble_pixels[half ? glyph & 0xf : glyph >> 4] << top;
+
+            for (i = 0; i < bytes; ++i)
+            {
+                uint8_t m = (uint8_t)(mask >> (24 - 8 * i));
+                uint8_t v = (fb[i] & ~m) | ((uint8_t)(bits >> (24 - 8 * i)) & m);
+                changed |= fb[i] ^ v;
+                fb[i] = v;
+            }
+            fb += LCD_FB_STRIDE;
+        }
+    }
+    return changed != 0;
 }
+#endif
+#endif
@@ -3,7 +3,8 @@
  *
  * Simple function header for interfacing with the LCD and rendering characters.
  *
- * The LCD is implemented as an 8-bit (1 byte per pixel) framebuffer.
+ * The LCD is implemented as an 8-bit (1 byte per pixel) framebuffer, or as a
+ * packed 4, 2 or 1 bit per pixel framebuffer selected by LCD_FB_BPP in lcd_config.h.
  *
  * Render coordinates are where the upper left corner of the character will start.
  *
@@ -26,19 +27,82 @@
 #ifndef __SIMPLE_LCD_H__
 #define __SIMPLE_LCD_H__
 
-/* initialize the LCD controller */
+#include <stdint.h>
+#include "lcd_config.h"
+
+/* counters for the row hashing push */
+struct LCDRowHashStats
+{
+    uint32_t pushes;        /* pushes done with row hashing */
+    uint32_t rows_hashed;   /* rows run through the CRC unit */
+    uint32_t rows_pushed;   /* rows found changed and sent, rows_hashed - rows_pushed were skipped */
+    uint32_t hash_cycles;   /* core cycles spent hashing */
+    uint32_t push_cycles;   /* core cycles spent sending the changed rows */
+};
+
+/* counters for the double buffer swaps */
+struct LCDSwapStats
+{
+    uint32_t swaps;             /* frames presented */
+    uint32_t deferred;          /* presents turned away by a push still in flight */
+    uint32_t wait_cycles;       /* core cycles from the first present turned away to the swap, summed */
+    uint32_t wait_cycles_max;   /* the longest of those waits */
+    uint32_t copy_cycles;       /* core cycles spent copying the changes into the new back buffer */
+};
+
+/* start initializing the LCD controller, LCDPoll() completes it */
 void LCDInit();
+/* run the LCD controller bring-up and background jobs such as the contrast save, returns non-zero
+ * while the LCD is not ready for pixels. Pushes call it too, and without a framebuffer drawing waits for it */
+int LCDPoll(void);
 /* clear the frame buffer */
 void LCDClear();
 /* enable / disable the LCD backlight */
 void LCDBacklightOn(int onoff);
 /* render a string at an arbitrary x,y location */
 void RenderString(unsigned int x, unsigned int y, const char* string);
+/* render one character at an arbitrary x,y location, black on white or inverted */
+void RenderGlyph(unsigned int x, unsigned int y, char c, int inverse);
 /* render a number as hexidecimal at an arbitrary x,y location */
 void RenderHexNumber(unsigned int x, unsigned int y, uint32_t num);
 /* render a number as decimal at an arbitrary x,y location */
 void RenderNumber(unsigned int x, unsigned int y, uint32_t num);
-/* Push the framebuffer to the LCD controller */
+/* fill a w x h rectangle at x,y with a gray value */
+void LCDFillRect(unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint8_t gray);
+/* copy a w x h block of gray bytes, w bytes per row, to x,y */
+void LCDBlit(unsigned int x, unsigned int y, unsigned int w, unsigned int h, const uint8_t* pixels);
+/* scroll rows y..y+h-1 up by n rows (down if n is negative), the rows scrolled in are cleared to WHITE.
+ * Regions of whole 4 line blocks in one half of the glass scrolled by multiples of 4 rows are scrolled
+ * by the controller for a few command bytes, anything else is redrawn from the framebuffer.
+ * Returns 1 if scrolled by the controller, 0 if redrawn or -1 if not possible (no framebuffer) */
+int LCDScrollRegion(unsigned int y, unsigned int h, int n);
+/* record a changed w x h region at x,y so the next push sends it */
+void LCDMarkDirty(unsigned int x, unsigned int y, unsigned int w, unsigned int h);
+/* return non-zero when the framebuffer has changes that have not been pushed, always with row hashing on */
+int LCDIsDirty(void);
+/* Push the changed regions of the framebuffer to the LCD controller */
 void PushBuffer(void);
+/* Present the frame drawn: with LCD_DOUBLE_BUFFER the back buffer is swapped to the front and pushed in
+ * the background, and drawing carries on in the new back buffer straight away. Never waits for a push in
+ * flight, returns -1 if one is (keep drawing and present again later), 0 if nothing changed or 1 once
+ * presented. With a single buffer it is PushBuffer() */
+int LCDPresent(void);
+/* copy out the buffer swap counters */
+void LCDGetSwapStats(struct LCDSwapStats* stats);
+/* return the framebuffer for drawing into directly, LCD_FB_BPP bits per pixel, LCD_FB_STRIDE bytes per row,
+ * 0 when built without a framebuffer (LCD_FRAMEBUFFER 0). With LCD_DOUBLE_BUFFER this is the back buffer,
+ * which changes on every present */
+uint8_t* LCDGetFramebuffer(void);
+/* enable / disable row hashing: pushes send only the rows whose CRC changed since the
+ * last push, so direct framebuffer writes need no LCDMarkDirty() calls */
+void LCDSetRowHashing(int onoff);
+/* copy out the row hashing counters */
+void LCDGetRowHashStats(struct LCDRowHashStats* stats);
+/* Start pushing the framebuffer in the background, done is called from an interrupt when finished.
+ * Returns 0 if started or -1 if a push is already in flight. The framebuffer and the key bus
+ * must not be touched until PushBusy() returns 0, except the back buffer with LCD_DOUBLE_BUFFER. */
+int PushBufferAsync(void (*done)(void));
+/* return non-zero while a background push is in flight */
+int PushBusy(void);
 
 #endif //__SIMPLE_LCD_H__
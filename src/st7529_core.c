@@ -25,9 +25,11 @@
 
 #include "stm32f10x.h"
 #include "st7529_core.h"
+#include "lcd_bus.h"
 #include "glassLayout.h"
+#include "lcd_config.h"
 #include "platform_config.h"
-#include "unistd.h"
+#include "systick.h"
 
 // Defines for the interface to the ST7529 LCD Controller
 //
@@ -303,6 +305,11 @@ typedef unsigned char lcd_bus_width_t;      //  8-bit data bus
 #define AREA_SCROLL_SET_PB3_NSB_GET(AREA_SCROLL_SET_PB3_WORD)       (((AREA_SCROLL_SET_PB3_WORD) & AREA_SCROLL_SET_PB3_NSB_MASK) >> AREA_SCROLL_SET_PB3_NSB_LSB)
 #define AREA_SCROLL_SET_PB3_NSB_PUT(AREA_SCROLL_SET_PB3_WORD)       (((AREA_SCROLL_SET_PB3_WORD) << AREA_SCROLL_SET_PB3_NSB_LSB) & AREA_SCROLL_SET_PB3_NSB_MASK)
 
+#define SCM_CENTER      0b00    // fixed areas above and below the scroll area
+#define SCM_TOP         0b01
+#define SCM_BOTTOM      0b10
+#define SCM_WHOLE       0b11
+
 #define AREA_SCROLL_SET_PB4_SCM_LSB                                 0
 #define AREA_SCROLL_SET_PB4_SCM_FIELD_LEN                           2
 #define AREA_SCROLL_SET_PB4_SCM_MASK                                (((1 << AREA_SCROLL_SET_PB4_SCM_FIELD_LEN) - 1) << AREA_SCROLL_SET_PB4_SCM_LSB)
@@ -361,6 +368,31 @@ typedef unsigned char lcd_bus_width_t;      //  8-bit data bus
 #define CONTRAST_CONTROL_PB2_VPR_8_6_PUT(CONTRAST_CONTROL_PB2_WORD) (((CONTRAST_CONTROL_PB2_WORD) << CONTRAST_CONTROL_PB2_VPR_8_6_LSB) & CONTRAST_CONTROL_PB2_VPR_8_6_MASK)
 
 
+/* Bus timing, derived from the core clock at compile time.
+ * ST7529 TDS8 (Write data setup time) is >= 150nS. The strobe code between setting
+ * the data and raising nWR takes some cycles on its own, the rest is padded with nops.
+ */
+#define ST7529_TDS8_NS              150
+#define ST7529_TDS8_CYCLES          ((ST7529_TDS8_NS * SYSCLK_MHZ + 999) / 1000)
+#define ST7529_SINGLE_STROBE_CYCLES 5   // writeCMD/writeDATA/readREG, measured TDS8 = 160nS with 6 nops at 72MHz
+#define ST7529_STREAM_STROBE_CYCLES 2   // the two stores in ST7529_STREAM_BYTE
+#define ST7529_PAD_NOPS(CYCLES)     (ST7529_TDS8_CYCLES > (CYCLES) ? ST7529_TDS8_CYCLES - (CYCLES) : 0)
+#define ST7529_SINGLE_NOPS          ST7529_PAD_NOPS(ST7529_SINGLE_STROBE_CYCLES)
+#define ST7529_STREAM_NOPS          ST7529_PAD_NOPS(ST7529_STREAM_STROBE_CYCLES)
+
+#if ST7529_SINGLE_NOPS > 16 || ST7529_STREAM_NOPS > 16
+#error "SYSCLK_MHZ too high for the ST7529 nop padding"
+#endif
+
+/* emit a compile time count of nops */
+#define ST7529_NOP_IF(N, COUNT) do { if ((COUNT) > (N)) asm volatile("nop"); } while (0)
+#define ST7529_NOPS(COUNT) do { \
+    ST7529_NOP_IF(0, COUNT);  ST7529_NOP_IF(1, COUNT);  ST7529_NOP_IF(2, COUNT);  ST7529_NOP_IF(3, COUNT); \
+    ST7529_NOP_IF(4, COUNT);  ST7529_NOP_IF(5, COUNT);  ST7529_NOP_IF(6, COUNT);  ST7529_NOP_IF(7, COUNT); \
+    ST7529_NOP_IF(8, COUNT);  ST7529_NOP_IF(9, COUNT);  ST7529_NOP_IF(10, COUNT); ST7529_NOP_IF(11, COUNT); \
+    ST7529_NOP_IF(12, COUNT); ST7529_NOP_IF(13, COUNT); ST7529_NOP_IF(14, COUNT); ST7529_NOP_IF(15, COUNT); \
+    } while (0)
+
 static inline void ST7529_rdLOW() { ST7529_nRD_GPIO->BRR = ST7529_nRD; }
 static inline void ST7529_rdHIGH() { ST7529_nRD_GPIO->BSRR = ST7529_nRD; }
 static inline void ST7529_wrLOW() { ST7529_nWR_GPIO->BRR = ST7529_nWR; }
@@ -377,166 +409,325 @@ static void ST7529_writeCMD( uint8_t cmd );
 static void ST7529_writeDATA( uint8_t data );
 static void ST7529_writeLineAddr( uint8_t startLine, uint8_t endLine );
 static void ST7529_writeColAddr( uint8_t startCol, uint8_t endCol );
-static void ST7529_loadContrastAdjFromEEPROM( void );
 
 /* init the pins on the LCD data bus for output */
 void ST7529_busInit(void)
 {
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_StructInit(&GPIO_InitStructure);
-
-    // Configure I/O for ST7529 8-bit data bus
-    GPIO_InitStructure.GPIO_Pin = ST7529_DATA_PINS;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_Init(ST7529_DATA_GPIO, &GPIO_InitStructure);
+    LCDBusAcquire(LCD_BUS_LCD_WRITE);
 }
 
 /* init the pins on the LCD data bus for intput */
 void ST7529_busToRead(void)
 {
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_StructInit(&GPIO_InitStructure);
-
-    // Configure I/O for ST7529 8-bit data bus
-    GPIO_InitStructure.GPIO_Pin = ST7529_DATA_PINS;
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_IN_FLOATING;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-    GPIO_Init(ST7529_DATA_GPIO, &GPIO_InitStructure);
+    LCDBusAcquire(LCD_BUS_LCD_READ);
 }
 
 
-/* Config the STM32 to talk to the ST7529 and init the ST7529 */
-void ST7529_init(void)
-{
-    GPIO_InitTypeDef GPIO_InitStructure;
-    GPIO_StructInit(&GPIO_InitStructure);
-    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
-    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
-
-    // Enable ST7529 GPIO peripherals
-    RCC_APB2PeriphClockCmd(ST7529_DATA_GPIO_CLK | ST7529_nCS_GPIO_CLK
-                           | ST7529_A0_GPIO_CLK | ST7529_nRST_GPIO_CLK | ST7529_nWR_GPIO_CLK, ENABLE);
-
-    ST7529_busInit();
-
-    // Configure I/O for ST7529 A0 and nCS
-    GPIO_InitStructure.GPIO_Pin = ST7529_A0 | ST7529_nCS;
-    GPIO_Init(ST7529_A0_GPIO, &GPIO_InitStructure);
-
-    // Configure I/O for ST7529 nRD and nWR
-    GPIO_InitStructure.GPIO_Pin = ST7529_nRD | ST7529_nWR;
-    GPIO_Init(ST7529_nRD_GPIO, &GPIO_InitStructure);
-
-    /* Configure I/O for ST7529 nRST */
-    GPIO_InitStructure.GPIO_Pin = ST7529_nRST;
-    GPIO_Init(ST7529_nRST_GPIO, &GPIO_InitStructure);
-
-    // Deselect the ST7529: Chip Select high
-    ST7529_rdHIGH();
-    ST7529_wrHIGH();
-    ST7529_csHIGH();
-    ST7529_a0LOW();
+#define EEPROM_DELAY (100000)
 
+/* Controller sequences are tables of steps, run a few at a time by ST7529_poll()
+ * so the delays they need don't hold up the rest of the system.
+ */
+#define ST7529_STEP_CMD         0   // write value as a command byte
+#define ST7529_STEP_DATA        1   // write value as a data byte
+#define ST7529_STEP_DELAY       2   // wait value mSecs
+#define ST7529_STEP_RST_LOW     3   // assert nRST
+#define ST7529_STEP_RST_HIGH    4   // release nRST
+#define ST7529_STEP_END         5   // sequence done
+
+struct ST7529_Step
+{
+    uint8_t op;
+    uint8_t value;
+};
+
+#define STEP_CMD(CMD)       { ST7529_STEP_CMD, (CMD) }
+#define STEP_DATA(DATA)     { ST7529_STEP_DATA, (DATA) }
+#define STEP_DELAY(MSECS)   { ST7529_STEP_DELAY, (MSECS) }
+#define STEP_RST_LOW()      { ST7529_STEP_RST_LOW, 0 }
+#define STEP_RST_HIGH()     { ST7529_STEP_RST_HIGH, 0 }
+#define STEP_END()          { ST7529_STEP_END, 0 }
+
+/* the controller bring-up, from reset to ready for pixel data */
+static const struct ST7529_Step init_steps[] = {
     /* Reset the LCD
      */
-    ST7529_rstLOW();
-    usleep(15000);
-    ST7529_rstHIGH();
-    usleep(15000);
+    STEP_RST_LOW(),
+    STEP_DELAY(15),
+    STEP_RST_HIGH(),
+    STEP_DELAY(15),
 
-
-    ST7529_writeCMD(LCD_NOP);
-    ST7529_writeCMD(LCD_NOP);
+    STEP_CMD(LCD_NOP),
+    STEP_CMD(LCD_NOP),
 
     /* Ext = 0 Commands to be written
      * Sleet Out
      * Oscillator ON
      */
-    ST7529_writeCMD(LCD_EXT_SET_0);
-    ST7529_writeCMD(LCD_SLEEP_OUT);
-    ST7529_writeCMD(LCD_INTERNAL_OSC_ON);
+    STEP_CMD(LCD_EXT_SET_0),
+    STEP_CMD(LCD_SLEEP_OUT),
+    STEP_CMD(LCD_INTERNAL_OSC_ON),
 
     /* Power Control Set
      * Booster must be ON first
      */
-    ST7529_writeCMD(LCD_POWER_CONTROL);
-    ST7529_writeDATA(POWER_CONTROL_PB1_VB_PUT(VB_ON));
-    usleep(20000);
+    STEP_CMD(LCD_POWER_CONTROL),
+    STEP_DATA(POWER_CONTROL_PB1_VB_PUT(VB_ON)),
+    STEP_DELAY(20),
 
     /* Power Control Set
      * Booster, Regulator and Follower ON
      */
-    ST7529_writeCMD(LCD_POWER_CONTROL);
-    usleep(1000);
-    ST7529_writeDATA(POWER_CONTROL_PB1_VB_PUT(VB_ON)
+    STEP_CMD(LCD_POWER_CONTROL),
+    STEP_DELAY(1),
+    STEP_DATA(POWER_CONTROL_PB1_VB_PUT(VB_ON)
               | POWER_CONTROL_PB1_VR_PUT(VR_ON)
-              | POWER_CONTROL_PB1_VF_PUT(VF_ON));
-    usleep(5000);
+              | POWER_CONTROL_PB1_VF_PUT(VF_ON)),
+    STEP_DELAY(5),
 
     /* Initial Contrast Values
      */
-    ST7529_writeContrast(LCD_CONTRAST_INIT);
+    STEP_CMD(LCD_CONTRAST_CONTROL),
+    STEP_DATA(LCD_CONTRAST_INIT & 0b111111),
+    STEP_DATA(LCD_CONTRAST_INIT >> 6),
 
     /* Display control
      */
-    ST7529_writeCMD(LCD_DISPLAY_CONTROL);
-    ST7529_writeDATA(DISPLAY_CONTROL_PB1_CLD_PUT(CLD_DIVIDE_2));
-    ST7529_writeDATA(0x1c);
-    ST7529_writeDATA(0Xa);
+    STEP_CMD(LCD_DISPLAY_CONTROL),
+    STEP_DATA(DISPLAY_CONTROL_PB1_CLD_PUT(CLD_DIVIDE_2)),
+    STEP_DATA(0x1c),
+    STEP_DATA(0Xa),
 
-    ST7529_writeCMD(LCD_DISPLAY_INVERT);
+    STEP_CMD(LCD_DISPLAY_INVERT),
 
     /* Set the COMs scan direction
      */
-    ST7529_writeCMD(LCD_COM_SCAN_DIR);
-    ST7529_writeDATA(COM_SCAN_DIR_PB1_CD_PUT( COM_79_0__80_159));
+    STEP_CMD(LCD_COM_SCAN_DIR),
+    STEP_DATA(COM_SCAN_DIR_PB1_CD_PUT( COM_79_0__80_159)),
 
     /* Set the data scan direction
      */
-    ST7529_writeCMD(LCD_DATA_SCAN_DIR);
-    ST7529_writeDATA(DATA_SCAN_DIR_PB1_LI_PUT(LI_INVERSE)                  // NORMAL
+    STEP_CMD(LCD_DATA_SCAN_DIR),
+    STEP_DATA(DATA_SCAN_DIR_PB1_LI_PUT(LI_INVERSE)                  // NORMAL
               | DATA_SCAN_DIR_PB1_CI_PUT(CI_NORMAL)                 // INVERSE
-              | DATA_SCAN_DIR_PB1_C_L_PUT(C_L_COLUMN_DIRECTION));   // LINE
-    ST7529_writeDATA(DATA_SCAN_DIR_PB2_CLR_PUT(CLR_NORMAL));               // REVERSE
-    ST7529_writeDATA(DATA_SCAN_DIR_PB3_GS_PUT(GS_3BYTE_3PIXEL));
+              | DATA_SCAN_DIR_PB1_C_L_PUT(C_L_COLUMN_DIRECTION)),   // LINE
+    STEP_DATA(DATA_SCAN_DIR_PB2_CLR_PUT(CLR_NORMAL)),               // REVERSE
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+    STEP_DATA(DATA_SCAN_DIR_PB3_GS_PUT(GS_2BYTE_3PIXEL)),
+#else
+    STEP_DATA(DATA_SCAN_DIR_PB3_GS_PUT(GS_3BYTE_3PIXEL)),
+#endif
 
     /* Set the start and end line registers
      */
-    ST7529_writeCMD(LCD_LINE_ADDR_SET);
-    ST7529_writeDATA(0);
-    ST7529_writeDATA(0x71);
+    STEP_CMD(LCD_LINE_ADDR_SET),
+    STEP_DATA(0),
+    STEP_DATA(0x71),
 
-    ST7529_writeDATA(LINE_ADDR_SET_PB1_START_LINE_PUT(0 + LCD_LINE_OFFSET));
-    ST7529_writeDATA(LINE_ADDR_SET_PB2_END_LINE_PUT(LCD_LINES - 1 + LCD_LINE_OFFSET));
+    STEP_DATA(LINE_ADDR_SET_PB1_START_LINE_PUT(0 + LCD_LINE_OFFSET)),
+    STEP_DATA(LINE_ADDR_SET_PB2_END_LINE_PUT(LCD_LINES - 1 + LCD_LINE_OFFSET)),
 
     /* Set the start and end column registers
      */
-    ST7529_writeCMD(LCD_COL_ADDR_SET);
-    ST7529_writeDATA(COL_ADDR_SET_PB1_START_COL_PUT(0 + LCD_COLUMN_OFFSET));
-    ST7529_writeDATA(COL_ADDR_SET_PB2_END_COL_PUT(LCD_COLUMNS - 1 + LCD_COLUMN_OFFSET));
-    usleep(1000);
+    STEP_CMD(LCD_COL_ADDR_SET),
+    STEP_DATA(COL_ADDR_SET_PB1_START_COL_PUT(0 + LCD_COLUMN_OFFSET)),
+    STEP_DATA(COL_ADDR_SET_PB2_END_COL_PUT(LCD_COLUMNS - 1 + LCD_COLUMN_OFFSET)),
+    STEP_DELAY(1),
 
     /* Executing EXT=1 Commands
      * Set the OSC frequency, FR = 12.7KHz
      * Set the Booster Efficiency, Booster FR = 6KHz
      * Set the Bias, 1/9 Bias
      */
-    ST7529_writeCMD(LCD_EXT_SET_1);
-    ST7529_writeCMD(LCD_ANALOG_CIRCUIT_SET);
-    ST7529_writeDATA(OSC_FREQ_ADJ_12_7_KHZ);
-    ST7529_writeDATA(BOOSTER_FREQ_SET_6_KHZ);
-    ST7529_writeDATA(LCD_BIAS_RATIO_1_9);
+    STEP_CMD(LCD_EXT_SET_1),
+    STEP_CMD(LCD_ANALOG_CIRCUIT_SET),
+    STEP_DATA(OSC_FREQ_ADJ_12_7_KHZ),
+    STEP_DATA(BOOSTER_FREQ_SET_6_KHZ),
+    STEP_DATA(LCD_BIAS_RATIO_1_9),
 
     /* Software initialize and EXT=0 Commands to follow
      */
-    ST7529_writeCMD(LCD_SOFTWARE_INITIAL);
+    STEP_CMD(LCD_SOFTWARE_INITIAL),
+
+    /* load the default contrast adjustment (from the EEPROM)
+     */
+    /* EXT0 Mode */
+    STEP_CMD(LCD_EXT_SET_0),
+    /* Initial Code "improves the EEPROM internal ACK" */
+    STEP_CMD(LCD_INITIAL_CODE),
+    STEP_DATA(0x19),  /* Fixed Param */
+    /* EXT1 Mode */
+    STEP_CMD(LCD_EXT_SET_1),
+    /* EEPROM On */
+    STEP_CMD(LCD_CONTROL_EEPROM),
+    STEP_DATA(0x0), /* Read Mode */
+    /* 100ms delay */
+    STEP_DELAY(EEPROM_DELAY / 1000),
+    /* Start the Read */
+    STEP_CMD(LCD_READ_EEPROM),
+    /* 100ms delay */
+    STEP_DELAY(EEPROM_DELAY / 1000),
+    /* Exit EEPROM Read */
+    STEP_CMD(LCD_CANCEL_EEPROM),
 
-    ST7529_loadContrastAdjFromEEPROM();
+    /* Return To EXT0 Mode */
+    STEP_CMD(LCD_EXT_SET_0),
 
-    ST7529_writeCMD(LCD_EXT_SET_0);
+    /* Display On */
+    STEP_CMD(LCD_DISPLAY_ON),
+    STEP_END()
+};
 
-    ST7529_writeCMD(LCD_DISPLAY_ON);
+/* save the contrast adjustment to the EEPROM */
+static const struct ST7529_Step eeprom_save_steps[] = {
+    /* EXT0 Mode */
+    STEP_CMD(LCD_EXT_SET_0),
+    /* Display Off, required by the controller while it writes the EEPROM */
+    STEP_CMD(LCD_DISPLAY_OFF),
+    /* Initial Code "improves the EEPROM internal ACK" */
+    STEP_CMD(LCD_INITIAL_CODE),
+    STEP_DATA(0x19),  /* Fixed Param */
+    /* EXT1 Mode */
+    STEP_CMD(LCD_EXT_SET_1),
+    /* EEPROM On */
+    STEP_CMD(LCD_CONTROL_EEPROM),
+    STEP_DATA(0x20), /* Write Mode */
+    /*  delay */
+    STEP_DELAY(EEPROM_DELAY / 1000),
+    /* Start the Write */
+    STEP_CMD(LCD_WRITE_EEPROM),
+    /* delay */
+    STEP_DELAY(EEPROM_DELAY / 1000),
+    /* Exit EEPROM Read */
+    STEP_CMD(LCD_CANCEL_EEPROM),
+
+    /* Return To EXT0 Mode */
+    STEP_CMD(LCD_EXT_SET_0),
+
+    /* Display On */
+    STEP_CMD(LCD_DISPLAY_ON),
+    STEP_END()
+};
+
+/* the sequence being run by ST7529_poll() */
+static struct
+{
+    const struct ST7529_Step* step;     // next step, 0 when idle
+    unsigned int wait_start;            // systick at the start of the current delay
+    unsigned int wait_msecs;            // length of the current delay
+    ST7529_sequenceDoneCallback done;   // called once the sequence completes
+    int ready;                          // the bring-up has completed
+} seq;
+
+/* start running a sequence of steps */
+static void ST7529_startSteps(const struct ST7529_Step* steps, ST7529_sequenceDoneCallback done)
+{
+    seq.wait_msecs = 0;
+    seq.done = done;
+    seq.step = steps;
+}
+
+/* Config the STM32 to talk to the ST7529 and start the ST7529 bring-up, ST7529_poll() runs it */
+void ST7529_initStart(void)
+{
+    GPIO_InitTypeDef GPIO_InitStructure;
+    GPIO_StructInit(&GPIO_InitStructure);
+    GPIO_InitStructure.GPIO_Mode = GPIO_Mode_Out_PP;
+    GPIO_InitStructure.GPIO_Speed = GPIO_Speed_2MHz;
+
+    // Enable ST7529 GPIO peripherals
+    RCC_APB2PeriphClockCmd(ST7529_DATA_GPIO_CLK | ST7529_nCS_GPIO_CLK
+                           | ST7529_A0_GPIO_CLK | ST7529_nRST_GPIO_CLK | ST7529_nWR_GPIO_CLK, ENABLE);
+
+    LCDBusInit();
+
+    // Configure I/O for ST7529 A0 and nCS
+    GPIO_InitStructure.GPIO_Pin = ST7529_A0 | ST7529_nCS;
+    GPIO_Init(ST7529_A0_GPIO, &GPIO_InitStructure);
+
+    // Configure I/O for ST7529 nRD and nWR
+    GPIO_InitStructure.GPIO_Pin = ST7529_nRD | ST7529_nWR;
+    GPIO_Init(ST7529_nRD_GPIO, &GPIO_InitStructure);
+
+    /* Configure I/O for ST7529 nRST */
+    GPIO_InitStructure.GPIO_Pin = ST7529_nRST;
+    GPIO_Init(ST7529_nRST_GPIO, &GPIO_InitStructure);
+
+    // Deselect the ST7529: Chip Select high
+    ST7529_rdHIGH();
+    ST7529_wrHIGH();
+    ST7529_csHIGH();
+    ST7529_a0LOW();
+
+    seq.ready = 0;
+    ST7529_startSteps(init_steps, 0);
+}
+
+/* run the steps of the current sequence up to the next delay, returns non-zero while it is still running */
+int ST7529_poll(void)
+{
+    if (!seq.step)
+        return 0;
+    if (getSysTick_mSecs() - seq.wait_start < seq.wait_msecs)
+        return 1;
+
+    /* as this bus is shared with the keys, we take it every time */
+    ST7529_busInit();
+
+    for (;;)
+    {
+        const struct ST7529_Step* step = seq.step++;
+
+        switch (step->op)
+        {
+        case ST7529_STEP_CMD:
+            ST7529_writeCMD(step->value);
+            break;
+        case ST7529_STEP_DATA:
+            ST7529_writeDATA(step->value);
+            break;
+        case ST7529_STEP_DELAY:
+            seq.wait_start = getSysTick_mSecs();
+            seq.wait_msecs = step->value;
+            return 1;
+        case ST7529_STEP_RST_LOW:
+            ST7529_rstLOW();
+            break;
+        case ST7529_STEP_RST_HIGH:
+            ST7529_rstHIGH();
+            break;
+        default:
+        {
+            ST7529_sequenceDoneCallback done = seq.done;
+
+            seq.step = 0;
+            seq.done = 0;
+            seq.ready = 1;
+            if (done)
+                done();
+            return 0;
+        }
+        }
+    }
+}
+
+/* check for a controller sequence still running */
+int ST7529_busy(void)
+{
+    return seq.step != 0;
+}
+
+/* check if the controller bring-up has completed */
+int ST7529_ready(void)
+{
+    return seq.ready;
+}
+
+/* Config the STM32 to talk to the ST7529 and init the ST7529, waiting for it to complete */
+void ST7529_init(void)
+{
+    ST7529_initStart();
+    while (ST7529_poll()) ;
 }
 
 /* Set data on the lines to the ST7529*/
@@ -556,13 +747,7 @@ static void ST7529_writeCMD( uint8_t cmd )
     ST7529_csLOW();
     ST7529_wrLOW();
     // Required to meet ST7529 TDS8 (Write data setup time) of >= 150nS.
-    // Measured TDS8 = 160nS.
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
+    ST7529_NOPS(ST7529_SINGLE_NOPS);
     ST7529_wrHIGH();
     ST7529_csHIGH();
     ST7529_a0HIGH();
@@ -575,17 +760,80 @@ static void ST7529_writeDATA( uint8_t data )
     ST7529_csLOW();
     ST7529_wrLOW();
     // Required to meet ST7529 TDS8 (Write data setup time) of >= 150nS.
-    // Measured TDS8 = 160nS.
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
+    ST7529_NOPS(ST7529_SINGLE_NOPS);
     ST7529_wrHIGH();
     ST7529_csHIGH();
 }
 
+/* strobe one byte of a stream padded with NOPS nops, nCS is already low and A0 high */
+#define ST7529_STREAM_BYTE_NOPS(DATA_BSRR, BYTE, NOPS) do { \
+    *(DATA_BSRR) = (uint32_t)(BYTE) | (uint32_t)(ST7529_DATA_RESET_MASK); \
+    ST7529_nWR_GPIO->BRR = ST7529_nWR; \
+    ST7529_NOPS(NOPS); \
+    ST7529_nWR_GPIO->BSRR = ST7529_nWR; \
+    } while (0)
+#define ST7529_STREAM_BYTE(DATA_BSRR, BYTE) ST7529_STREAM_BYTE_NOPS(DATA_BSRR, BYTE, ST7529_STREAM_NOPS)
+
+/* The stream strobe padding is tuned at run time by ST7529_calibrateBus(). The nops have to
+ * be inline to be cheap, so there is one stream writer per padding and the tuned one is called. */
+typedef void (*ST7529_streamWriter)(const uint8_t* data, unsigned int count);
+
+#define ST7529_STREAM_WRITER(N) \
+static void ST7529_writeDataStream##N(const uint8_t* data, unsigned int count) \
+{ \
+    volatile uint32_t* const bsrr = &ST7529_DATA_GPIO->BSRR; \
+    while (count >= 4) \
+    { \
+        ST7529_STREAM_BYTE_NOPS(bsrr, data[0], N); \
+        ST7529_STREAM_BYTE_NOPS(bsrr, data[1], N); \
+        ST7529_STREAM_BYTE_NOPS(bsrr, data[2], N); \
+        ST7529_STREAM_BYTE_NOPS(bsrr, data[3], N); \
+        data += 4; \
+        count -= 4; \
+    } \
+    while (count--) \
+        ST7529_STREAM_BYTE_NOPS(bsrr, *data++, N); \
+}
+
+ST7529_STREAM_WRITER(0)  ST7529_STREAM_WRITER(1)  ST7529_STREAM_WRITER(2)  ST7529_STREAM_WRITER(3)
+ST7529_STREAM_WRITER(4)  ST7529_STREAM_WRITER(5)  ST7529_STREAM_WRITER(6)  ST7529_STREAM_WRITER(7)
+ST7529_STREAM_WRITER(8)  ST7529_STREAM_WRITER(9)  ST7529_STREAM_WRITER(10) ST7529_STREAM_WRITER(11)
+ST7529_STREAM_WRITER(12) ST7529_STREAM_WRITER(13) ST7529_STREAM_WRITER(14) ST7529_STREAM_WRITER(15)
+ST7529_STREAM_WRITER(16)
+
+/* the stream writers by nop count, up to the ST7529_NOPS limit */
+static const ST7529_streamWriter stream_writers[17] = {
+    ST7529_writeDataStream0,  ST7529_writeDataStream1,  ST7529_writeDataStream2,  ST7529_writeDataStream3,
+    ST7529_writeDataStream4,  ST7529_writeDataStream5,  ST7529_writeDataStream6,  ST7529_writeDataStream7,
+    ST7529_writeDataStream8,  ST7529_writeDataStream9,  ST7529_writeDataStream10, ST7529_writeDataStream11,
+    ST7529_writeDataStream12, ST7529_writeDataStream13, ST7529_writeDataStream14, ST7529_writeDataStream15,
+    ST7529_writeDataStream16
+};
+
+/* the stream padding in use, the datasheet timing until calibrated */
+static unsigned int stream_nops = ST7529_STREAM_NOPS;
+
+/* write count data bytes with nCS held low across the whole run */
+void ST7529_writeDataStream(const uint8_t* data, unsigned int count)
+{
+    ST7529_csLOW();
+    stream_writers[stream_nops](data, count);
+    ST7529_csHIGH();
+}
+
+/* write the same data byte count times with nCS held low across the whole run */
+void ST7529_writeDataRepeat(uint8_t data, unsigned int count)
+{
+    volatile uint32_t* const bsrr = &ST7529_DATA_GPIO->BSRR;
+
+    ST7529_csLOW();
+    while (count--)
+    {
+        ST7529_STREAM_BYTE(bsrr, data);
+    }
+    ST7529_csHIGH();
+}
+
 /* read a data byte from the ST7529 */
 static uint8_t ST7529_readREG( void )
 {
@@ -595,17 +843,26 @@ static uint8_t ST7529_readREG( void )
     ST7529_csLOW();
     ST7529_rdLOW();
     // Required to meet ST7529 TDS8 (Read data setup time) of >= 150nS.
-    // Measured TDS8 = 160nS.
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
-    asm("nop");
+    ST7529_NOPS(ST7529_SINGLE_NOPS);
     val = ST7529_DATA_GPIO->IDR & ST7529_DATA_PINS;
     ST7529_rdHIGH();
     ST7529_csHIGH();
     ST7529_a0HIGH();
+    ST7529_busInit();
+    return val;
+}
+
+/* read a display data byte from the ST7529, the bus must already be turned to read */
+static uint8_t ST7529_readDATA( void )
+{
+    uint8_t val;
+    ST7529_csLOW();
+    ST7529_rdLOW();
+    // Required to meet ST7529 TDS8 (Read data setup time) of >= 150nS.
+    ST7529_NOPS(ST7529_SINGLE_NOPS);
+    val = ST7529_DATA_GPIO->IDR & ST7529_DATA_PINS;
+    ST7529_rdHIGH();
+    ST7529_csHIGH();
     return val;
 }
 
@@ -632,6 +889,16 @@ static void ST7529_writeDATAStreamPrep(void)
     ST7529_a0HIGH();
 }
 
+/* set the write window and leave the controller ready for a stream of pixel data */
+void ST7529_beginWindowWrite(uint8_t startLine, uint8_t endLine, uint8_t startCol, uint8_t endCol)
+{
+    ST7529_writeLineAddr(startLine, endLine);
+    ST7529_writeColAddr(startCol, endCol);
+
+    ST7529_writeCMD(LCD_MEM_WRITE);
+    ST7529_writeDATAStreamPrep();
+}
+
 /* set a contrast value into the controller */
 void ST7529_writeContrast(uint16_t contrast)
 {
@@ -641,78 +908,25 @@ void ST7529_writeContrast(uint16_t contrast)
     ST7529_writeDATA(contrast >> 6);
 }
 
-#define EEPROM_DELAY (100000)
-
-#if 0
-static void dumb_usleep(unsigned int delusecs)
-{
-    int i;
-    for (i = 0; i < 36 * delusecs; i++ );
-}
-#define usleep dumb_usleep
-#endif
-
-/* save the contrast adjustment to the controller */
-void ST7529_saveContrastAdjToEEPROM(void)
+/* start saving the contrast adjustment to the controller, ST7529_poll() runs it */
+int ST7529_saveContrastAdjToEEPROMStart(ST7529_sequenceDoneCallback done)
 {
-    // Save contrast as default (to the EEPROM)
+    if (seq.step)
+        return -1;
 
-    /* EXT0 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_0);
-    /* Display Off */
-    ST7529_writeCMD(LCD_DISPLAY_OFF);
-    /* Initial Code "improves the EEPROM internal ACK" */
-    ST7529_writeCMD(LCD_INITIAL_CODE);
-    ST7529_writeDATA(0x19);  /* Fixed Param */
-    /* EXT1 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_1);
-    /* EEPROM On */
-    ST7529_writeCMD(LCD_CONTROL_EEPROM);
-    ST7529_writeDATA(0x20); /* Write Mode */
-    /*  delay */
-    usleep(EEPROM_DELAY);
-    /* Start the Write */
-    ST7529_writeCMD(LCD_WRITE_EEPROM);
-    /* delay */
-    usleep(EEPROM_DELAY);
-    /* Exit EEPROM Read */
-    ST7529_writeCMD(LCD_CANCEL_EEPROM);
-
-    /* Return To EXT0 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_0);
-
-    /* Display On */
-    ST7529_writeCMD(LCD_DISPLAY_ON);
+    ST7529_startSteps(eeprom_save_steps, done);
+    return 0;
 }
 
-/* load the default contrast adjustment (from the EEPROM) */
-void ST7529_loadContrastAdjFromEEPROM(void)
+/* save the contrast adjustment to the controller, waiting for it to complete */
+void ST7529_saveContrastAdjToEEPROM(void)
 {
-    /* EXT0 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_0);
-    /* Initial Code "improves the EEPROM internal ACK" */
-    ST7529_writeCMD(LCD_INITIAL_CODE);
-    ST7529_writeDATA(0x19);  /* Fixed Param */
-    /* EXT1 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_1);
-    /* EEPROM On */
-    ST7529_writeCMD(LCD_CONTROL_EEPROM);
-    ST7529_writeDATA(0x0); /* Read Mode */
-    /* 100ms delay */
-    usleep(EEPROM_DELAY);
-    /* Start the Read */
-    ST7529_writeCMD(LCD_READ_EEPROM);
-    /* 100ms delay */
-    usleep(EEPROM_DELAY);
-    /* Exit EEPROM Read */
-    ST7529_writeCMD(LCD_CANCEL_EEPROM);
-
-    /* Return To EXT0 Mode */
-    ST7529_writeCMD(LCD_EXT_SET_0);
+    /* finish whatever was running first */
+    while (ST7529_poll()) ;
+    ST7529_saveContrastAdjToEEPROMStart(0);
+    while (ST7529_poll()) ;
 }
 
-#undef usleep
-
 /* contrast up */
 void ST7529_volumeUpContrast(void)
 {
@@ -728,39 +942,533 @@ void ST7529_volumeDownContrast(void)
 /* write a buffer to the controller */
 void ST7529_bufferToLCD(uint8_t * bufferMem)
 {
-    int col, row;
+    /* the windows are fixed, scrolled display RAM needs the rows split where they wrap */
+    if (ST7529_isScrolled())
+        ST7529_rectToLCD(bufferMem, 0, 0, LCD_USABLE_PIXELS_PER_ROW - 1, LCD_LINES - 1);
+    else
+        ST7529_windowsToLCD(bufferMem, 0, LCD_GLASS_WINDOW_COUNT);
+}
 
-    /* Write LCD lines 46 to 79 */
-    ST7529_writeLineAddr(46, 79);
-    ST7529_writeColAddr(3, 84);
+/* the 8-bit buffer being sent by ST7529_rectToLCD */
+static const uint8_t* rect_buffer;
+
+/* Bus timing calibration: test patterns are streamed into a display RAM line that is not on the
+ * glass with each stream padding from none up, and read back with the datasheet timing. The
+ * fewest nops that pass every pattern, plus a margin, are used from then on. */
+#define ST7529_CAL_MARGIN_NOPS      1
+#define ST7529_CAL_PATTERNS         4
+#define ST7529_CAL_ROUNDS           4
+#define ST7529_CAL_BYTES            (LCD_COLUMNS * LCD_BYTES_PER_COLUMN)
+
+/* bits of each byte read back from display RAM that hold pixel data */
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+#define ST7529_CAL_READ_MASK        0xff
+#else
+#define ST7529_CAL_READ_MASK        0xf8
+#endif
+
+static uint8_t cal_bytes[ST7529_CAL_BYTES];
+
+/* fill the calibration bytes with pattern p: alternating bits, walking ones and a ramp */
+static void ST7529_calPattern(unsigned int p)
+{
+    unsigned int i;
+
+    for (i = 0; i < ST7529_CAL_BYTES; ++i)
+    {
+        switch (p)
+        {
+        case 0:  cal_bytes[i] = i & 1 ? 0xaa : 0x55; break;
+        case 1:  cal_bytes[i] = i & 1 ? 0x55 : 0xaa; break;
+        case 2:  cal_bytes[i] = 0x80 >> (i % 8) | (i & 8 ? 0 : 0x01); break;
+        default: cal_bytes[i] = (uint8_t)(i * 7); break;
+        }
+    }
+}
 
+/* stream the calibration bytes to the scratch line with nops padding and check they read back */
+static int ST7529_calCheck(unsigned int nops)
+{
+    const struct ST7529_GlassWindow* w = ST7529_glassWindows;
+    unsigned int i;
+    int ok = 1;
+
+    ST7529_busInit();
+    ST7529_writeLineAddr(LCD_SCRATCH_LINE, LCD_SCRATCH_LINE);
+    ST7529_writeColAddr(w->startCol, w->startCol + LCD_COLUMNS - 1);
     ST7529_writeCMD(LCD_MEM_WRITE);
     ST7529_writeDATAStreamPrep();
+    ST7529_csLOW();
+    stream_writers[nops](cal_bytes, ST7529_CAL_BYTES);
+    ST7529_csHIGH();
+
+    ST7529_writeLineAddr(LCD_SCRATCH_LINE, LCD_SCRATCH_LINE);
+    ST7529_writeColAddr(w->startCol, w->startCol + LCD_COLUMNS - 1);
+    ST7529_writeCMD(LCD_MEM_READ);
+    ST7529_writeDATAStreamPrep();
+    ST7529_busToRead();
+    /* the first read after addressing returns stale data */
+    ST7529_readDATA();
+    for (i = 0; i < ST7529_CAL_BYTES; ++i)
+    {
+        if ((ST7529_readDATA() ^ cal_bytes[i]) & ST7529_CAL_READ_MASK)
+            ok = 0;
+    }
+    ST7529_busInit();
+    return ok;
+}
+
+/* find the fewest stream nops that write display RAM reliably at the running clock */
+int ST7529_calibrateBus(void)
+{
+    unsigned int nops, p, round;
+
+    if (!ST7529_ready() || ST7529_busy())
+        return -1;
+
+    for (nops = 0; nops < ST7529_STREAM_NOPS; ++nops)
+    {
+        int ok = 1;
 
-    for (row = 0; row <= 33; ++row) {
-        /* Dummy writes for first 2 LCD pixels that aren't mapped */
-        ST7529_writeDATA(0);
-        ST7529_writeDATA(0);
-        for (col = 0; col < LCD_USABLE_PIXELS_PER_ROW; ++col) {
-            ST7529_writeDATA(*bufferMem++);
+        for (p = 0; ok && p < ST7529_CAL_PATTERNS; ++p)
+        {
+            ST7529_calPattern(p);
+            for (round = 0; ok && round < ST7529_CAL_ROUNDS; ++round)
+                ok = ST7529_calCheck(nops);
         }
+        if (ok)
+            break;
     }
 
-    /* Skip some unmapped lines */
+    nops += ST7529_CAL_MARGIN_NOPS;
+    stream_nops = nops < ST7529_STREAM_NOPS ? nops : ST7529_STREAM_NOPS;
+    return stream_nops;
+}
+
+/* the stream strobe padding in use */
+unsigned int ST7529_streamNops(void)
+{
+    return stream_nops;
+}
 
-    /* Write LCD lines 126 to 159 */
-    ST7529_writeLineAddr(126, 159);
-    ST7529_writeColAddr(3, 84);
+/* time count bytes written to the scratch line through the pixel stream and then a byte at a time */
+int ST7529_benchBus(unsigned int count, uint32_t* stream_cycles, uint32_t* byte_cycles)
+{
+    const struct ST7529_GlassWindow* w = ST7529_glassWindows;
+    unsigned int i, n;
+    uint32_t start;
 
-    ST7529_writeCMD(LCD_MEM_WRITE);
-    ST7529_writeDATAStreamPrep();
+    if (!ST7529_ready() || ST7529_busy())
+        return -1;
 
-    for (row = 0; row <= 33; ++row) {
-        /* Dummy writes for first 2 LCD pixels that aren't mapped */
-        ST7529_writeDATA(0);
-        ST7529_writeDATA(0);
-        for (col = 0; col < LCD_USABLE_PIXELS_PER_ROW; ++col) {
-            ST7529_writeDATA(*bufferMem++);
+    ST7529_calPattern(3);
+    ST7529_busInit();
+
+    /* the window wraps, so the line is simply written over and over */
+    ST7529_beginWindowWrite(LCD_SCRATCH_LINE, LCD_SCRATCH_LINE, w->startCol, w->startCol + LCD_COLUMNS - 1);
+    start = getCycleCount();
+    for (i = 0; i < count; i += n)
+    {
+        n = count - i < ST7529_CAL_BYTES ? count - i : ST7529_CAL_BYTES;
+        ST7529_writeDataStream(cal_bytes, n);
+    }
+    *stream_cycles = getCycleCount() - start;
+
+    ST7529_beginWindowWrite(LCD_SCRATCH_LINE, LCD_SCRATCH_LINE, w->startCol, w->startCol + LCD_COLUMNS - 1);
+    start = getCycleCount();
+    for (i = 0; i < count; ++i)
+        ST7529_writeDATA(cal_bytes[i % ST7529_CAL_BYTES]);
+    *byte_cycles = getCycleCount() - start;
+    return 0;
+}
+
+/* row source for a plain 8-bit buffer */
+static const uint8_t* bufferRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    return rect_buffer + row * LCD_USABLE_PIXELS_PER_ROW + first;
+}
+
+/* write the rectangle x0,y0 - x1,y1 (inclusive) of a buffer to the controller */
+void ST7529_rectToLCD(uint8_t * bufferMem, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    rect_buffer = bufferMem;
+    ST7529_rectToLCDFrom(bufferRow, x0, y0, x1, y1);
+}
+
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+/* a row packed two bytes per three pixels */
+static uint8_t packed_row[LCD_COLUMNS * LCD_BYTES_PER_COLUMN];
+
+/* pack one controller column: 5 bits of the first pixel, 6 of the second, 5 of the third */
+#define PACK_2B3P(OUT, P0, P1, P2) do { \
+    (OUT)[0] = ((P0) & 0xf8) | ((P1) >> 5); \
+    (OUT)[1] = (((P1) << 3) & 0xe0) | ((P2) >> 3); \
+    } while (0)
+
+/* pack dummies blank pixels and then count gray bytes into whole columns, a part column at the end is
+ * filled up with blank pixels */
+static const uint8_t* ST7529_pack2B3P(const uint8_t* pixels, unsigned int dummies, unsigned int count)
+{
+    uint8_t* out = packed_row;
+
+    /* whole columns of the unmapped dummies */
+    for (; dummies >= LCD_PIXELS_PER_COLUMN; dummies -= LCD_PIXELS_PER_COLUMN)
+    {
+        PACK_2B3P(out, 0, 0, 0);
+        out += 2;
+    }
+    if (dummies)
+    {
+        /* the last dummies and the first glass pixels share a column */
+        uint8_t first[LCD_PIXELS_PER_COLUMN] = { 0 };
+        unsigned int i;
+
+        for (i = dummies; i < LCD_PIXELS_PER_COLUMN && count; ++i, --count)
+            first[i] = *pixels++;
+        PACK_2B3P(out, first[0], first[1], first[2]);
+        out += 2;
+    }
+    while (count >= 3)
+    {
+        PACK_2B3P(out, pixels[0], pixels[1], pixels[2]);
+        out += 2;
+        pixels += 3;
+        count -= 3;
+    }
+    if (count)
+        PACK_2B3P(out, pixels[0], count > 1 ? pixels[1] : 0, 0);
+    return packed_row;
+}
+#endif
+
+/* the controller scrolls in blocks of lines */
+#define ST7529_SCROLL_BLOCK_LINES   4
+#define ST7529_DISPLAY_BLOCKS       (LCD_CONTROLLER_LINES / ST7529_SCROLL_BLOCK_LINES)
+
+/* the hardware scroll area, framebuffer rows top..top+rows-1 are held in display RAM
+ * rotated by offset rows, rows is 0 when there is no area */
+static struct
+{
+    unsigned int top;
+    unsigned int rows;
+    unsigned int offset;
+} scroll_area;
+
+/* the glass window descriptors, generated from the layout */
+#define ST7529_GLASS_WINDOW(ROW, ROWS, LINE, COL0, COL1, PAD) \
+    { (ROW) * LCD_USABLE_PIXELS_PER_ROW, (ROW), (ROWS), (LINE), (COL0), (COL1), (PAD), \
+      ((COL1) - (COL0) + 1) * LCD_PIXELS_PER_COLUMN - (PAD) },
+const struct ST7529_GlassWindow ST7529_glassWindows[LCD_GLASS_WINDOW_COUNT] = {
+    LCD_GLASS_WINDOWS(ST7529_GLASS_WINDOW)
+};
+
+/* the glass window holding framebuffer row */
+const struct ST7529_GlassWindow* ST7529_glassWindow(unsigned int row)
+{
+    const struct ST7529_GlassWindow* w = ST7529_glassWindows;
+
+    while (w < &ST7529_glassWindows[LCD_GLASS_WINDOW_COUNT - 1] && row >= w->firstRow + w->rows)
+        ++w;
+    return w;
+}
+
+/* write glass windows first..first+count-1 of an 8-bit buffer to the controller */
+void ST7529_windowsToLCD(const uint8_t * bufferMem, unsigned int first, unsigned int count)
+{
+    const struct ST7529_GlassWindow* w = &ST7529_glassWindows[first];
+    const struct ST7529_GlassWindow* end = w + count;
+
+    if (end > &ST7529_glassWindows[LCD_GLASS_WINDOW_COUNT])
+        end = &ST7529_glassWindows[LCD_GLASS_WINDOW_COUNT];
+
+    for (; w < end; ++w)
+    {
+        const uint8_t* src = bufferMem + w->offset;
+        unsigned int row;
+
+        /* the keys may be sampled between windows */
+        LCDBusGap();
+        ST7529_beginWindowWrite(w->startLine, w->startLine + w->rows - 1, w->startCol, w->endCol);
+
+        for (row = 0; row < w->rows; ++row)
+        {
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+            ST7529_writeDataStream(ST7529_pack2B3P(src, w->pad, w->rowBytes),
+                                   (w->endCol - w->startCol + 1) * LCD_BYTES_PER_COLUMN);
+#else
+            if (w->pad)
+                ST7529_writeDataRepeat(0, w->pad);
+            ST7529_writeDataStream(src, w->rowBytes);
+#endif
+            src += LCD_USABLE_PIXELS_PER_ROW;
+        }
+    }
+}
+
+/* the controller line of a framebuffer row, before any scrolling */
+static unsigned int ST7529_glassLine(unsigned int row)
+{
+    const struct ST7529_GlassWindow* w = ST7529_glassWindow(row);
+    return w->startLine + row - w->firstRow;
+}
+
+/* the controller line of framebuffer row y0 and the last row up to y1 with consecutive lines */
+static unsigned int ST7529_bankRows(unsigned int y0, unsigned int y1, unsigned int* line)
+{
+    const struct ST7529_GlassWindow* w = ST7529_glassWindow(y0);
+    unsigned int last = w->firstRow + w->rows - 1;
+    unsigned int top = scroll_area.top;
+
+    *line = ST7529_glassLine(y0);
+    if (scroll_area.rows)
+    {
+        if (y0 < top)
+        {
+            /* stop above the scroll area */
+            if (last >= top)
+                last = top - 1;
+        }
+        else if (y0 < top + scroll_area.rows)
+        {
+            /* inside the area, stop where the rotation wraps */
+            unsigned int phys = (y0 - top + scroll_area.offset) % scroll_area.rows;
+            *line = ST7529_glassLine(top) + phys;
+            last = y0 + scroll_area.rows - phys - 1;
+            if (last >= top + scroll_area.rows)
+                last = top + scroll_area.rows - 1;
+        }
+    }
+    return last > y1 ? y1 : last;
+}
+
+/* check that rows top..top+rows-1 can be scrolled by the controller */
+int ST7529_scrollAreaValid(unsigned int top, unsigned int rows)
+{
+    return rows >= 2 * ST7529_SCROLL_BLOCK_LINES
+        && rows % ST7529_SCROLL_BLOCK_LINES == 0
+        && ST7529_glassLine(top) % ST7529_SCROLL_BLOCK_LINES == 0
+        && ST7529_glassWindow(top) == ST7529_glassWindow(top + rows - 1)
+        && top + rows <= LCD_LINES;
+}
+
+/* tell the controller where the scroll area starts */
+static void ST7529_writeScrollStart(void)
+{
+    unsigned int top_block = ST7529_glassLine(scroll_area.top) / ST7529_SCROLL_BLOCK_LINES;
+
+    ST7529_writeCMD(LCD_SCROLL_START_SET);
+    ST7529_writeDATA(START_SCROLL_SET_PB1_SB_PUT(top_block + scroll_area.offset / ST7529_SCROLL_BLOCK_LINES));
+}
+
+/* make rows top..top+rows-1 the hardware scroll area, rows 0 removes it. Returns -1 if
+ * the rows are not whole blocks of one bank. The area starts out unscrolled, so its
+ * display RAM has to be rewritten if it was scrolled before. */
+int ST7529_scrollArea(unsigned int top, unsigned int rows)
+{
+    if (rows && !ST7529_scrollAreaValid(top, rows))
+        return -1;
+
+    if (!rows)
+    {
+        scroll_area.rows = 0;
+        ST7529_writeCMD(LCD_AREA_SCROLL_SET);
+        ST7529_writeDATA(AREA_SCROLL_SET_PB1_TB_PUT(0));
+        ST7529_writeDATA(AREA_SCROLL_SET_PB2_BB_PUT(ST7529_DISPLAY_BLOCKS - 1));
+        ST7529_writeDATA(AREA_SCROLL_SET_PB3_NSB_PUT(ST7529_DISPLAY_BLOCKS - 1));
+        ST7529_writeDATA(AREA_SCROLL_SET_PB4_SCM_PUT(SCM_WHOLE));
+        ST7529_writeCMD(LCD_SCROLL_START_SET);
+        ST7529_writeDATA(START_SCROLL_SET_PB1_SB_PUT(0));
+        return 0;
+    }
+
+    scroll_area.top = top;
+    scroll_area.rows = rows;
+    scroll_area.offset = 0;
+
+    ST7529_writeCMD(LCD_AREA_SCROLL_SET);
+    ST7529_writeDATA(AREA_SCROLL_SET_PB1_TB_PUT(ST7529_glassLine(top) / ST7529_SCROLL_BLOCK_LINES));
+    ST7529_writeDATA(AREA_SCROLL_SET_PB2_BB_PUT(ST7529_glassLine(top + rows - 1) / ST7529_SCROLL_BLOCK_LINES));
+    ST7529_writeDATA(AREA_SCROLL_SET_PB3_NSB_PUT(ST7529_DISPLAY_BLOCKS - 1));
+    ST7529_writeDATA(AREA_SCROLL_SET_PB4_SCM_PUT(SCM_CENTER));
+    ST7529_writeScrollStart();
+    return 0;
+}
+
+/* scroll the hardware scroll area up by rows (down if negative), a multiple of the block size.
+ * Only the start address changes, the rows that come into view still hold the ones that left. */
+int ST7529_scrollBy(int rows)
+{
+    int n = scroll_area.rows;
+
+    if (!n || rows % ST7529_SCROLL_BLOCK_LINES)
+        return -1;
+
+    scroll_area.offset = ((int)scroll_area.offset + rows % n + n) % n;
+    ST7529_writeScrollStart();
+    return 0;
+}
+
+/* check for a scrolled hardware scroll area */
+int ST7529_isScrolled(void)
+{
+    return scroll_area.rows && scroll_area.offset;
+}
+
+/* write the rectangle x0,y0 - x1,y1 (inclusive) to the controller, fetching the rows from source */
+void ST7529_rectToLCDFrom(ST7529_rowSource source, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    while (y0 <= y1)
+    {
+        /* one window per glass window, widened to whole controller columns of 3 pixels,
+         * the pad pixels at the start of each glass row are unmapped and written as dummies */
+        const struct ST7529_GlassWindow* w = ST7529_glassWindow(y0);
+        unsigned int startCol = (x0 + w->pad) / LCD_PIXELS_PER_COLUMN;
+        unsigned int endCol = (x1 + w->pad) / LCD_PIXELS_PER_COLUMN;
+        unsigned int dummies = w->pad > startCol * LCD_PIXELS_PER_COLUMN ? w->pad - startCol * LCD_PIXELS_PER_COLUMN : 0;
+        unsigned int first = startCol * LCD_PIXELS_PER_COLUMN + dummies - w->pad;
+        unsigned int count = (endCol - startCol + 1) * LCD_PIXELS_PER_COLUMN - dummies;
+        unsigned int line;
+        unsigned int last = ST7529_bankRows(y0, y1, &line);
+        unsigned int row;
+
+        /* the keys may be sampled between windows */
+        LCDBusGap();
+        ST7529_beginWindowWrite(line, line + last - y0, w->startCol + startCol, w->startCol + endCol);
+
+        for (row = y0; row <= last; ++row) {
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+            ST7529_writeDataStream(ST7529_pack2B3P(source(row, first, count), dummies, count),
+                                   (endCol - startCol + 1) * LCD_BYTES_PER_COLUMN);
+#else
+            /* Dummy writes for first 2 LCD pixels that aren't mapped */
+            if (dummies)
+                ST7529_writeDataRepeat(0, dummies);
+            ST7529_writeDataStream(source(row, first, count), count);
+#endif
+        }
+
+        y0 = last + 1;
+    }
+}
+
+/* the bits of each bus byte of a column that hold each of its pixels */
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+static const uint8_t column_masks[LCD_PIXELS_PER_COLUMN][LCD_BYTES_PER_COLUMN] = {
+    { 0xf8, 0x00 }, { 0x07, 0xe0 }, { 0x00, 0x1f }
+};
+#else
+static const uint8_t column_masks[LCD_PIXELS_PER_COLUMN][LCD_BYTES_PER_COLUMN] = {
+    { 0xff, 0x00, 0x00 }, { 0x00, 0xff, 0x00 }, { 0x00, 0x00, 0xff }
+};
+#endif
+
+/* write column col in read-modify-write mode, pixels p0..p1 (controller pixels of the row)
+ * come from the source, the pad ones are cleared and the rest are read back and kept */
+static void ST7529_mergeColumn(const uint8_t* pixels, unsigned int col, unsigned int p0, unsigned int p1, unsigned int pad)
+{
+    uint8_t gray[LCD_PIXELS_PER_COLUMN];
+    uint8_t bytes[LCD_BYTES_PER_COLUMN];
+    uint8_t mask[LCD_BYTES_PER_COLUMN];
+    unsigned int i, b;
+
+    for (b = 0; b < LCD_BYTES_PER_COLUMN; ++b)
+        mask[b] = 0;
+
+    for (i = 0; i < LCD_PIXELS_PER_COLUMN; ++i)
+    {
+        unsigned int p = col * LCD_PIXELS_PER_COLUMN + i;
+
+        gray[i] = 0;
+        if (p < pad || (p >= p0 && p <= p1))
+        {
+            if (p >= pad)
+                gray[i] = pixels[p - p0];
+            for (b = 0; b < LCD_BYTES_PER_COLUMN; ++b)
+                mask[b] |= column_masks[i][b];
         }
     }
+
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+    PACK_2B3P(bytes, gray[0], gray[1], gray[2]);
+#else
+    for (b = 0; b < LCD_BYTES_PER_COLUMN; ++b)
+        bytes[b] = gray[b];
+#endif
+
+    for (b = 0; b < LCD_BYTES_PER_COLUMN; ++b)
+    {
+        uint8_t val = bytes[b];
+
+        /* reads leave the address alone, the write moves it on */
+        if (mask[b] != 0xff)
+        {
+            ST7529_busToRead();
+            val = (ST7529_readDATA() & ~mask[b]) | (val & mask[b]);
+            ST7529_busInit();
+        }
+        ST7529_writeDATA(val);
+    }
+}
+
+/* write pixels x0..x1 of rows y0..y1 straight into display RAM, fetching the rows from source.
+ * The controller columns at the edges are only partly covered, their other pixels are kept
+ * through the controller's read-modify-write mode. */
+void ST7529_rectMergeToLCD(ST7529_rowSource source, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    while (y0 <= y1)
+    {
+        /* one window per glass window, in controller pixels counting the pad ones at the start of the row */
+        const struct ST7529_GlassWindow* w = ST7529_glassWindow(y0);
+        unsigned int p0 = x0 + w->pad;
+        unsigned int p1 = x1 + w->pad;
+        unsigned int startCol = p0 / LCD_PIXELS_PER_COLUMN;
+        unsigned int endCol = p1 / LCD_PIXELS_PER_COLUMN;
+        /* the columns in between are covered entirely and simply streamed */
+        unsigned int midCol = startCol;
+        int midCount;
+        unsigned int line;
+        unsigned int last = ST7529_bankRows(y0, y1, &line);
+        unsigned int row;
+
+        if ((startCol == 0 && w->pad) || startCol * LCD_PIXELS_PER_COLUMN < p0)
+            ++midCol;
+        midCount = (int)((p1 + 1) / LCD_PIXELS_PER_COLUMN) - (int)midCol;
+
+        /* the keys may be sampled between windows */
+        LCDBusGap();
+        ST7529_writeLineAddr(line, line + last - y0);
+        ST7529_writeColAddr(w->startCol + startCol, w->startCol + endCol);
+        ST7529_writeCMD(LCD_READ_MODIFY_WRITE);
+        ST7529_writeDATAStreamPrep();
+
+        /* the first read after addressing returns stale data */
+        ST7529_busToRead();
+        ST7529_readDATA();
+        ST7529_busInit();
+
+        for (row = y0; row <= last; ++row)
+        {
+            const uint8_t* pixels = source(row, x0, x1 - x0 + 1);
+            unsigned int col = startCol;
+
+            if (midCol != startCol)
+                ST7529_mergeColumn(pixels, col++, p0, p1, w->pad);
+            if (midCount > 0)
+            {
+                const uint8_t* mid = pixels + midCol * LCD_PIXELS_PER_COLUMN - p0;
+#if LCD_GRAY_PACKING == LCD_GRAY_2B3P
+                ST7529_writeDataStream(ST7529_pack2B3P(mid, 0, midCount * LCD_PIXELS_PER_COLUMN),
+                                       midCount * LCD_BYTES_PER_COLUMN);
+#else
+                ST7529_writeDataStream(mid, midCount * LCD_PIXELS_PER_COLUMN);
+#endif
+                col += midCount;
+            }
+            if (col <= endCol)
+                ST7529_mergeColumn(pixels, col, p0, p1, w->pad);
+        }
+
+        ST7529_writeCMD(LCD_READ_MODIFY_WRITE_END);
+        y0 = last + 1;
+    }
 }
@@ -29,6 +29,28 @@ extern "C" {
 
 typedef enum { WHITE = 0, BLACK = 0b11111100 } gray_t;
 
+/* supplies the gray bytes of pixels first to first + count - 1 of a framebuffer row */
+typedef const uint8_t* (*ST7529_rowSource)(unsigned int row, unsigned int first, unsigned int count);
+
+/* a window of the glass in display RAM, built from LCD_GLASS_WINDOWS in glassLayout.h */
+struct ST7529_GlassWindow
+{
+    uint16_t offset;    /* the window's first pixel in an 8-bit framebuffer */
+    uint8_t firstRow;   /* the window's first framebuffer row */
+    uint8_t rows;       /* framebuffer rows in the window */
+    uint8_t startLine;  /* controller line of the first row */
+    uint8_t startCol;   /* controller columns of the window */
+    uint8_t endCol;
+    uint8_t pad;        /* dummy pixels written ahead of each row */
+    uint8_t rowBytes;   /* framebuffer pixels in each row */
+};
+
+/* the glass windows, in framebuffer row order */
+extern const struct ST7529_GlassWindow ST7529_glassWindows[];
+
+/* called from ST7529_poll() once a controller sequence has completed */
+typedef void (*ST7529_sequenceDoneCallback)(void);
+
 /* contrast defines */
 #define LCD_CONTRAST_MIN	130
 #define LCD_CONTRAST_OPT	252
@@ -43,10 +65,22 @@ typedef enum { WHITE = 0, BLACK = 0b11111100 } gray_t;
 
 /* init the pins on the LCD data bus for output */
 void ST7529_busInit(void);
-/* init the LCD controller */
+/* init the LCD controller, waiting for the bring-up to complete */
 void ST7529_init(void);
-/* save the contrast adjustment so the contrast is set to LCD_CONTRAST_OPT it is optimal */
+/* start the LCD controller bring-up, ST7529_poll() runs it to completion */
+void ST7529_initStart(void);
+/* run the pending controller sequence, returns non-zero while it is still running */
+int ST7529_poll(void);
+/* return non-zero once the controller bring-up has completed */
+int ST7529_ready(void);
+/* save the contrast adjustment so the contrast is set to LCD_CONTRAST_OPT it is optimal, waiting for it to complete */
 void ST7529_saveContrastAdjToEEPROM(void);
+/* start saving the contrast adjustment in the background, ST7529_poll() runs it and done is called
+ * when complete. The display is off while the EEPROM is written. Returns 0 if started or -1 if a
+ * controller sequence is already running */
+int ST7529_saveContrastAdjToEEPROMStart(ST7529_sequenceDoneCallback done);
+/* return non-zero while a controller sequence (bring-up or EEPROM save) is running */
+int ST7529_busy(void);
 /* increase the contrast */
 void ST7529_volumeUpContrast(void);
 /* decrease the contrast */
@@ -55,6 +89,38 @@ void ST7529_volumeDownContrast(void);
 void ST7529_writeContrast(uint16_t contrast);
 /* write a buffer to the LCD controller */
 void ST7529_bufferToLCD(uint8_t * bufferMem);
+/* write glass windows first..first+count-1 of an 8-bit buffer to the LCD controller, the display RAM must not be scrolled */
+void ST7529_windowsToLCD(const uint8_t * bufferMem, unsigned int first, unsigned int count);
+/* return the glass window holding framebuffer row */
+const struct ST7529_GlassWindow* ST7529_glassWindow(unsigned int row);
+/* write the rectangle x0,y0 - x1,y1 (inclusive) of a buffer to the LCD controller */
+void ST7529_rectToLCD(uint8_t * bufferMem, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1);
+/* write the rectangle x0,y0 - x1,y1 (inclusive) to the LCD controller, fetching each row from source */
+void ST7529_rectToLCDFrom(ST7529_rowSource source, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1);
+/* write pixels x0..x1 of rows y0..y1 straight into display RAM, keeping the other pixels of the edge columns */
+void ST7529_rectMergeToLCD(ST7529_rowSource source, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1);
+/* check that framebuffer rows top..top+rows-1 are whole scroll blocks of one bank */
+int ST7529_scrollAreaValid(unsigned int top, unsigned int rows);
+/* make framebuffer rows top..top+rows-1 the hardware scroll area (rows 0 removes it), returns -1 if not valid */
+int ST7529_scrollArea(unsigned int top, unsigned int rows);
+/* scroll the hardware scroll area up by rows (down if negative), a multiple of 4, returns -1 if not possible */
+int ST7529_scrollBy(int rows);
+/* return non-zero while the hardware scroll area is scrolled, the display RAM rows are then rotated */
+int ST7529_isScrolled(void);
+/* tune the pixel stream strobe timing by writing test patterns to display RAM off the glass and reading
+ * them back. Returns the nops now padding each strobe, or -1 if the controller is not ready or busy */
+int ST7529_calibrateBus(void);
+/* return the nops padding each pixel stream strobe */
+unsigned int ST7529_streamNops(void);
+/* write count bytes to display RAM off the glass through the pixel stream and then through the single
+ * byte path, returning the core cycles each took. Returns -1 if the controller is not ready or busy */
+int ST7529_benchBus(unsigned int count, uint32_t* stream_cycles, uint32_t* byte_cycles);
+/* write count bytes of pixel data to the current window, keeping the chip selected for the whole run */
+void ST7529_writeDataStream(const uint8_t* data, unsigned int count);
+/* write the same pixel byte count times to the current window */
+void ST7529_writeDataRepeat(uint8_t data, unsigned int count);
+/* set the write window and prepare the controller for a stream of pixel data */
+void ST7529_beginWindowWrite(uint8_t startLine, uint8_t endLine, uint8_t startCol, uint8_t endCol);
 
 #ifdef __cplusplus
 }
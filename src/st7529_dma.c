@@ -0,0 +1,282 @@
+/*
+ * Description:
+ *
+ * Background (timer + DMA driven) framebuffer push to the ST7529 LCD controller
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*
+ * The push is split into bursts of at most 256 bytes (one glass row). Each
+ * burst runs the write timer in one-pulse mode with the repetition counter
+ * set to the burst length, so the timer produces exactly one nWR pulse per
+ * byte and stops on its own. Every timer period:
+ *
+ *   CC3 -> DMA writes 0xff to GPIOC->BRR  (data lines cleared)
+ *   CC4 -> DMA writes the byte to GPIOC->BSRR (data lines set)
+ *   CH1N drives nWR low from CCR1 until the update event, the rising edge
+ *        at the update event latches the byte into the controller.
+ *
+ * The update interrupt fires once per burst and queues the next one. The
+ * window address commands between the glass windows are written by the
+ * CPU from the interrupt with nWR handed back to the GPIO.
+ */
+
+#include "stm32f10x.h"
+#include "st7529_core.h"
+#include "st7529_dma.h"
+#include "lcd_bus.h"
+#include "glassLayout.h"
+#include "platform_config.h"
+
+/* bus timing for the background push */
+#define ST7529_DMA_BYTE_NS      400     // one byte every 400nS
+#define ST7529_DMA_WR_LOW_NS    100     // nWR low time before the latching rising edge
+#define ST7529_DMA_CLEAR_CYCLE  1       // timer count of the BRR (clear) request
+#define ST7529_DMA_SET_CYCLE    2       // timer count of the BSRR (set) request
+
+/* the most pad pixels a glass window may have */
+#define ST7529_DMA_DUMMY_BYTES  4
+
+/* every window's pad pixels have to fit in dummy_bytes */
+#define ST7529_DMA_PAD_FITS(ROW, ROWS, LINE, COL0, COL1, PAD) && (PAD) <= ST7529_DMA_DUMMY_BYTES
+typedef char ST7529_dmaPadCheck[(1 LCD_GLASS_WINDOWS(ST7529_DMA_PAD_FITS)) ? 1 : -1];
+
+/* nWR pin configuration nibbles for GPIOx->CRL */
+#define ST7529_nWR_CRL_SHIFT    (7 * 4)
+#define ST7529_nWR_CRL_GPIO     0x2     // general purpose output push-pull, 2MHz
+#define ST7529_nWR_CRL_TIMER    0xa     // alternate function output push-pull, 2MHz
+
+/* source words for the DMA channels that do not increment */
+static const uint32_t clear_mask = 0xff;
+static const uint8_t dummy_bytes[ST7529_DMA_DUMMY_BYTES] = { 0 };
+
+/* state of the push in flight, owned by the timer interrupt while busy */
+static struct
+{
+    const uint8_t* base;
+    const uint8_t* src;
+    const struct ST7529_GlassWindow* window;
+    const struct ST7529_GlassWindow* end;
+    unsigned int rows_left;
+    int in_row;
+    ST7529_pushDoneCallback done;
+    volatile int busy;
+} push;
+
+/* hand the nWR pin to the GPIO or to the write timer */
+static inline void nWRtoGPIO(void)
+{
+    ST7529_nWR_GPIO->CRL = (ST7529_nWR_GPIO->CRL & ~(0xful << ST7529_nWR_CRL_SHIFT)) | (ST7529_nWR_CRL_GPIO << ST7529_nWR_CRL_SHIFT);
+}
+static inline void nWRtoTimer(void)
+{
+    ST7529_nWR_GPIO->CRL = (ST7529_nWR_GPIO->CRL & ~(0xful << ST7529_nWR_CRL_SHIFT)) | (ST7529_nWR_CRL_TIMER << ST7529_nWR_CRL_SHIFT);
+}
+
+/* strobe count bytes from src onto the bus, inc selects if src is an array or a repeated byte */
+static void startBurst(const uint8_t* src, unsigned int count, int inc)
+{
+    ST7529_WR_DMA_CLEAR->CCR &= ~DMA_CCR1_EN;
+    ST7529_WR_DMA_SET->CCR &= ~DMA_CCR1_EN;
+
+    ST7529_WR_DMA_CLEAR->CNDTR = count;
+    ST7529_WR_DMA_SET->CNDTR = count;
+    ST7529_WR_DMA_SET->CMAR = (uint32_t)src;
+    if (inc)
+        ST7529_WR_DMA_SET->CCR |= DMA_CCR1_MINC;
+    else
+        ST7529_WR_DMA_SET->CCR &= ~DMA_CCR1_MINC;
+
+    ST7529_WR_DMA_CLEAR->CCR |= DMA_CCR1_EN;
+    ST7529_WR_DMA_SET->CCR |= DMA_CCR1_EN;
+
+    /* load the repetition counter without raising an update interrupt (URS is set) */
+    ST7529_WR_TIM->RCR = count - 1;
+    ST7529_WR_TIM->EGR = TIM_EGR_UG;
+    ST7529_WR_TIM->CR1 |= TIM_CR1_CEN;
+}
+
+/* start the next row with its pad pixels, or the row itself when there are none */
+static void startRow(void)
+{
+    push.in_row = !push.window->pad;
+    if (push.in_row)
+        startBurst(push.src, push.window->rowBytes, 1);
+    else
+        startBurst(dummy_bytes, push.window->pad, 0);
+}
+
+/* address the next glass window and start its first row */
+static void startWindow(void)
+{
+    const struct ST7529_GlassWindow* w = push.window;
+
+    ST7529_nCS_GPIO->BSRR = ST7529_nCS;
+    /* the keys may be sampled between windows */
+    LCDBusGap();
+    nWRtoGPIO();
+    ST7529_beginWindowWrite(w->startLine, w->startLine + w->rows - 1, w->startCol, w->endCol);
+    nWRtoTimer();
+    ST7529_nCS_GPIO->BRR = ST7529_nCS;
+
+    push.src = push.base + w->offset;
+    push.rows_left = w->rows;
+    startRow();
+}
+
+/* init the timer, DMA channels and interrupt used for background pushes */
+void ST7529_dmaInit(void)
+{
+    RCC_ClocksTypeDef clocks;
+    TIM_TimeBaseInitTypeDef TIM_TimeBaseStructure;
+    TIM_OCInitTypeDef TIM_OCInitStructure;
+    NVIC_InitTypeDef NVIC_InitStructure;
+    unsigned int tim_mhz, period, wr_low;
+
+    RCC_APB2PeriphClockCmd(ST7529_WR_TIM_CLK, ENABLE);
+    RCC_AHBPeriphClockCmd(ST7529_WR_DMA_CLK, ENABLE);
+
+    /* the timer runs at PCLK2, doubled when APB2 is divided */
+    RCC_GetClocksFreq(&clocks);
+    tim_mhz = clocks.PCLK2_Frequency / 1000000;
+    if (clocks.PCLK2_Frequency != clocks.HCLK_Frequency)
+        tim_mhz *= 2;
+    period = (ST7529_DMA_BYTE_NS * tim_mhz + 999) / 1000;
+    wr_low = (ST7529_DMA_WR_LOW_NS * tim_mhz + 999) / 1000;
+
+    /* one byte per period, stopping after the repetition counter expires */
+    TIM_TimeBaseStructInit(&TIM_TimeBaseStructure);
+    TIM_TimeBaseStructure.TIM_Period = period - 1;
+    TIM_TimeBaseStructure.TIM_Prescaler = 0;
+    TIM_TimeBaseStructure.TIM_CounterMode = TIM_CounterMode_Up;
+    TIM_TimeBaseInit(ST7529_WR_TIM, &TIM_TimeBaseStructure);
+    ST7529_WR_TIM->CR1 |= TIM_CR1_OPM | TIM_CR1_URS;
+
+    /* nWR on CH1N: with only the N output enabled it follows OC1REF, high until CCR1 then low */
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_PWM1;
+    TIM_OCInitStructure.TIM_OutputState = TIM_OutputState_Disable;
+    TIM_OCInitStructure.TIM_OutputNState = TIM_OutputNState_Enable;
+    TIM_OCInitStructure.TIM_OCNPolarity = TIM_OCNPolarity_High;
+    TIM_OCInitStructure.TIM_OCNIdleState = TIM_OCNIdleState_Set;
+    TIM_OCInitStructure.TIM_Pulse = period - wr_low;
+    TIM_OC1Init(ST7529_WR_TIM, &TIM_OCInitStructure);
+
+    /* CC3 and CC4 only raise the DMA requests that drive the data lines */
+    TIM_OCStructInit(&TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_OCMode = TIM_OCMode_Timing;
+    TIM_OCInitStructure.TIM_Pulse = ST7529_DMA_CLEAR_CYCLE;
+    TIM_OC3Init(ST7529_WR_TIM, &TIM_OCInitStructure);
+    TIM_OCInitStructure.TIM_Pulse = ST7529_DMA_SET_CYCLE;
+    TIM_OC4Init(ST7529_WR_TIM, &TIM_OCInitStructure);
+
+    TIM_DMACmd(ST7529_WR_TIM, TIM_DMA_CC3 | TIM_DMA_CC4, ENABLE);
+    TIM_CtrlPWMOutputs(ST7529_WR_TIM, ENABLE);
+
+    /* clear then set: the clear channel has the higher priority so it always wins arbitration */
+    ST7529_WR_DMA_CLEAR->CCR = DMA_CCR1_DIR | DMA_CCR1_PSIZE_1 | DMA_CCR1_MSIZE_1 | DMA_CCR1_PL;
+    ST7529_WR_DMA_CLEAR->CPAR = (uint32_t)&ST7529_DATA_GPIO->BRR;
+    ST7529_WR_DMA_CLEAR->CMAR = (uint32_t)&clear_mask;
+
+    /* byte reads are zero extended into the word write, so only the set half of BSRR is touched */
+    ST7529_WR_DMA_SET->CCR = DMA_CCR1_DIR | DMA_CCR1_PSIZE_1 | DMA_CCR1_PL_1;
+    ST7529_WR_DMA_SET->CPAR = (uint32_t)&ST7529_DATA_GPIO->BSRR;
+
+    TIM_ClearITPendingBit(ST7529_WR_TIM, TIM_IT_Update);
+    TIM_ITConfig(ST7529_WR_TIM, TIM_IT_Update, ENABLE);
+
+    /* below the USB and UART so the push only fills the gaps */
+    NVIC_InitStructure.NVIC_IRQChannel = ST7529_WR_TIM_IRQ;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 2;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init(&NVIC_InitStructure);
+}
+
+/* start pushing a framebuffer in the background */
+int ST7529_dmaStartPush(const uint8_t * bufferMem, ST7529_pushDoneCallback done)
+{
+    return ST7529_dmaStartPushWindows(bufferMem, 0, LCD_GLASS_WINDOW_COUNT, done);
+}
+
+/* start pushing glass windows first..first+count-1 of a framebuffer in the background */
+int ST7529_dmaStartPushWindows(const uint8_t * bufferMem, unsigned int first, unsigned int count,
+                               ST7529_pushDoneCallback done)
+{
+    if (push.busy)
+        return -1;
+    if (first >= LCD_GLASS_WINDOW_COUNT || !count)
+    {
+        if (done)
+            done();
+        return 0;
+    }
+    if (count > LCD_GLASS_WINDOW_COUNT - first)
+        count = LCD_GLASS_WINDOW_COUNT - first;
+
+    push.busy = 1;
+    LCDBusLock(1);
+    push.base = bufferMem;
+    push.window = &ST7529_glassWindows[first];
+    push.end = push.window + count;
+    push.done = done;
+
+    startWindow();
+    return 0;
+}
+
+/* return non-zero while a background push owns the LCD bus */
+int ST7529_dmaBusy(void)
+{
+    return push.busy;
+}
+
+/* end of a burst, queue the next one */
+void ST7529_WR_TIM_HANDLER(void)
+{
+    ST7529_WR_TIM->SR = (uint16_t)~TIM_SR_UIF;
+
+    if (!push.in_row)
+    {
+        /* dummies are out, now the row itself */
+        push.in_row = 1;
+        startBurst(push.src, push.window->rowBytes, 1);
+        return;
+    }
+
+    push.src += LCD_USABLE_PIXELS_PER_ROW;
+    if (--push.rows_left)
+    {
+        startRow();
+        return;
+    }
+
+    if (++push.window < push.end)
+    {
+        startWindow();
+        return;
+    }
+
+    /* all windows done, give the bus back */
+    ST7529_nCS_GPIO->BSRR = ST7529_nCS;
+    nWRtoGPIO();
+    LCDBusGap();
+    LCDBusLock(0);
+    push.busy = 0;
+    if (push.done)
+        push.done();
+}
@@ -0,0 +1,47 @@
+/*
+ * Description:
+ *
+ * Background (timer + DMA driven) framebuffer push to the ST7529 LCD controller
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __ST7529_DMA_H__
+#define __ST7529_DMA_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* called from interrupt context once the last byte of a push has been strobed */
+typedef void (*ST7529_pushDoneCallback)(void);
+
+/* init the timer, DMA channels and interrupt used for background pushes */
+void ST7529_dmaInit(void);
+/* start pushing a framebuffer in the background, returns 0 if started or -1 if a push is in flight */
+int ST7529_dmaStartPush(const uint8_t * bufferMem, ST7529_pushDoneCallback done);
+/* start pushing glass windows first..first+count-1 (ST7529_glassWindows) of a framebuffer in the background,
+ * returns 0 if started or -1 if a push is in flight */
+int ST7529_dmaStartPushWindows(const uint8_t * bufferMem, unsigned int first, unsigned int count,
+                               ST7529_pushDoneCallback done);
+/* return non-zero while a background push owns the LCD bus */
+int ST7529_dmaBusy(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif //__ST7529_DMA_H__
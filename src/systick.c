@@ -23,6 +23,11 @@
 
 static volatile unsigned int systick = 0;
 
+/* DWT cycle counter, not described by this CMSIS version */
+#define DWT_CTRL            (*(volatile uint32_t*)0xE0001000)
+#define DWT_CYCCNT          (*(volatile uint32_t*)0xE0001004)
+#define DWT_CTRL_CYCCNTENA  (1ul << 0)
+
 /* initialize the systick from millisecond interrupts */
 void mSecSysTickInit(unsigned int sysfreq)
 {
@@ -32,6 +37,20 @@ void mSecSysTickInit(unsigned int sysfreq)
     NVIC_SetPriority (SysTick_IRQn, 0);
 }
 
+/* start the free running core cycle counter */
+void CycleCounterInit(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/* get the current core cycle count, wraps every 2^32 cycles */
+uint32_t getCycleCount(void)
+{
+    return DWT_CYCCNT;
+}
+
 /* get the current systick count */
 volatile unsigned int getSysTick_mSecs(void)
 {
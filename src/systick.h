@@ -24,6 +24,9 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
+
+#include <stdint.h>
+
 /* Simple Millisecond SysTick */
 
 /* initialize itwith the system frequency */
@@ -32,6 +35,11 @@ void mSecSysTickInit(unsigned int sysfreq);
 /* retrieve the current value */
 volatile unsigned int getSysTick_mSecs(void);
 
+/* start the core cycle counter used for fine grained timing */
+void CycleCounterInit(void);
+/* retrieve the current core cycle count */
+uint32_t getCycleCount(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,390 @@
+/*
+ * Description:
+ *
+ * VT100/ANSI terminal emulator. Bytes are parsed in batches into the text grid, so
+ * only the cells they change are drawn. Handled are the C0 controls (BS, HT, LF, VT,
+ * FF, CR), ESC D/E/M/7/8/c and the CSI sequences for cursor movement (A B C D E F G
+ * H f d), erasing (J K X), lines (L M), scrolling (S T r), save/restore (s u) and
+ * SGR inverse (m 0 7 27). Anything else is parsed and dropped.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "terminal.h"
+#include "text_grid.h"
+
+/* parser states */
+#define TERM_NORMAL     0
+#define TERM_ESC        1   // had ESC
+#define TERM_CSI        2   // had ESC [, collecting parameters
+#define TERM_SKIP       3   // had ESC and an intermediate byte, drop the final byte
+
+#define TERM_MAX_PARAMS 8
+#define TERM_MAX_PARAM  9999    // parameters are clamped here, well past any count on the grid
+#define TERM_TAB_WIDTH  8
+
+static struct
+{
+    unsigned int col, row;
+    unsigned int top, bottom;       /* the scroll region */
+    unsigned int saved_col, saved_row;
+    uint8_t saved_attr;
+    uint8_t attr;
+    int wrap_pending;               /* the last column was written, the next character wraps */
+    int state;
+    int private_mode;               /* CSI ? sequence */
+    unsigned int params[TERM_MAX_PARAMS];
+    unsigned int param_count;
+} term;
+
+/* blank cells col0..col1 of row */
+static void eraseCells(unsigned int row, unsigned int col0, unsigned int col1)
+{
+    while (col0 <= col1 && col0 < TEXT_GRID_COLS)
+        TextGridPutChar(col0++, row, ' ', TEXT_ATTR_NORMAL);
+}
+
+/* reset the terminal */
+void TerminalInit(void)
+{
+    unsigned int row;
+
+    term.col = term.row = 0;
+    term.top = 0;
+    term.bottom = TEXT_GRID_ROWS - 1;
+    term.saved_col = term.saved_row = 0;
+    term.saved_attr = term.attr = TEXT_ATTR_NORMAL;
+    term.wrap_pending = 0;
+    term.state = TERM_NORMAL;
+    for (row = 0; row < TEXT_GRID_ROWS; ++row)
+        eraseCells(row, 0, TEXT_GRID_COLS - 1);
+}
+
+/* move the cursor down a line, scrolling the region at its bottom */
+static void lineFeed(void)
+{
+    if (term.row == term.bottom)
+        TextGridScroll(term.top, term.bottom, 1);
+    else if (term.row < TEXT_GRID_ROWS - 1)
+        ++term.row;
+}
+
+/* move the cursor up a line, scrolling the region at its top */
+static void reverseLineFeed(void)
+{
+    if (term.row == term.top)
+        TextGridScroll(term.top, term.bottom, -1);
+    else if (term.row)
+        --term.row;
+}
+
+/* put the cursor at col,row, clamped to the grid */
+static void moveTo(int col, int row)
+{
+    term.col = col < 0 ? 0 : col >= TEXT_GRID_COLS ? TEXT_GRID_COLS - 1 : col;
+    term.row = row < 0 ? 0 : row >= TEXT_GRID_ROWS ? TEXT_GRID_ROWS - 1 : row;
+    term.wrap_pending = 0;
+}
+
+/* parameter i, or def when it is missing or 0 */
+static unsigned int param(unsigned int i, unsigned int def)
+{
+    return i < term.param_count && term.params[i] ? term.params[i] : def;
+}
+
+/* the SGR attributes, only inverse is shown */
+static void selectGraphicRendition(void)
+{
+    unsigned int i;
+
+    if (!term.param_count)
+        term.attr = TEXT_ATTR_NORMAL;
+    for (i = 0; i < term.param_count; ++i)
+    {
+        if (term.params[i] == 0)
+            term.attr = TEXT_ATTR_NORMAL;
+        else if (term.params[i] == 7)
+            term.attr |= TEXT_ATTR_INVERSE;
+        else if (term.params[i] == 27)
+            term.attr &= ~TEXT_ATTR_INVERSE;
+    }
+}
+
+/* carry out a complete CSI sequence ending in final */
+static void csiDispatch(char final)
+{
+    unsigned int n = param(0, 1);
+    unsigned int row;
+
+    if (term.private_mode)
+        return;
+
+    switch (final)
+    {
+    case 'A': moveTo(term.col, (int)term.row - (int)n); break;
+    case 'B': moveTo(term.col, term.row + n); break;
+    case 'C': moveTo(term.col + n, term.row); break;
+    case 'D': moveTo((int)term.col - (int)n, term.row); break;
+    case 'E': moveTo(0, term.row + n); break;
+    case 'F': moveTo(0, (int)term.row - (int)n); break;
+    case 'G': moveTo(n - 1, term.row); break;
+    case 'd': moveTo(term.col, n - 1); break;
+    case 'H':
+    case 'f': moveTo(param(1, 1) - 1, n - 1); break;
+    case 'J':
+        switch (param(0, 0))
+        {
+        case 0:
+            eraseCells(term.row, term.col, TEXT_GRID_COLS - 1);
+            for (row = term.row + 1; row < TEXT_GRID_ROWS; ++row)
+                eraseCells(row, 0, TEXT_GRID_COLS - 1);
+            break;
+        case 1:
+            for (row = 0; row < term.row; ++row)
+                eraseCells(row, 0, TEXT_GRID_COLS - 1);
+            eraseCells(term.row, 0, term.col);
+            break;
+        default:
+            for (row = 0; row < TEXT_GRID_ROWS; ++row)
+                eraseCells(row, 0, TEXT_GRID_COLS - 1);
+            break;
+        }
+        break;
+    case 'K':
+        switch (param(0, 0))
+        {
+        case 0: eraseCells(term.row, term.col, TEXT_GRID_COLS - 1); break;
+        case 1: eraseCells(term.row, 0, term.col); break;
+        default: eraseCells(term.row, 0, TEXT_GRID_COLS - 1); break;
+        }
+        break;
+    case 'X': eraseCells(term.row, term.col, term.col + n - 1); break;
+    case 'L':
+        if (term.row >= term.top && term.row <= term.bottom)
+            TextGridScroll(term.row, term.bottom, -(int)n);
+        break;
+    case 'M':
+        if (term.row >= term.top && term.row <= term.bottom)
+            TextGridScroll(term.row, term.bottom, n);
+        break;
+    case 'S': TextGridScroll(term.top, term.bottom, n); break;
+    case 'T': TextGridScroll(term.top, term.bottom, -(int)n); break;
+    case 'r':
+    {
+        unsigned int top = param(0, 1) - 1;
+        unsigned int bottom = param(1, TEXT_GRID_ROWS) - 1;
+        if (bottom >= TEXT_GRID_ROWS)
+            bottom = TEXT_GRID_ROWS - 1;
+        if (top < bottom)
+        {
+            term.top = top;
+            term.bottom = bottom;
+            moveTo(0, 0);
+        }
+        break;
+    }
+    case 's':
+        term.saved_col = term.col;
+        term.saved_row = term.row;
+        term.saved_attr = term.attr;
+        break;
+    case 'u':
+        moveTo(term.saved_col, term.saved_row);
+        term.attr = term.saved_attr;
+        break;
+    case 'm': selectGraphicRendition(); break;
+    default: break;
+    }
+}
+
+/* carry out ESC followed by c */
+static void escDispatch(char c)
+{
+    term.state = TERM_NORMAL;
+    switch (c)
+    {
+    case '[':
+        term.state = TERM_CSI;
+        term.private_mode = 0;
+        term.param_count = 0;
+        term.params[0] = 0;
+        break;
+    case 'D': lineFeed(); break;
+    case 'E': term.col = 0; lineFeed(); break;
+    case 'M': reverseLineFeed(); break;
+    case '7':
+        term.saved_col = term.col;
+        term.saved_row = term.row;
+        term.saved_attr = term.attr;
+        break;
+    case '8':
+        moveTo(term.saved_col, term.saved_row);
+        term.attr = term.saved_attr;
+        break;
+    case 'c': TerminalInit(); break;
+    default:
+        /* character set selections and the like carry one more byte */
+        if (c >= 0x20 && c <= 0x2f)
+            term.state = TERM_SKIP;
+        break;
+    }
+}
+
+/* a byte of a CSI sequence */
+static void csiByte(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        if (!term.param_count)
+            term.param_count = 1;
+        if (term.param_count <= TERM_MAX_PARAMS)
+        {
+            unsigned int* param = &term.params[term.param_count - 1];
+
+            /* clamp as the digits come so a long run cannot wrap */
+            *param = *param * 10 + (c - '0');
+            if (*param > TERM_MAX_PARAM)
+                *param = TERM_MAX_PARAM;
+        }
+    }
+    else if (c == ';')
+    {
+        if (!term.param_count)
+            term.param_count = 1;
+        if (term.param_count < TERM_MAX_PARAMS)
+            term.params[term.param_count] = 0;
+        ++term.param_count;
+    }
+    else if (c == '?')
+    {
+        term.private_mode = 1;
+    }
+    else if (c >= 0x40 && c <= 0x7e)
+    {
+        if (term.param_count > TERM_MAX_PARAMS)
+            term.param_count = TERM_MAX_PARAMS;
+        term.state = TERM_NORMAL;
+        csiDispatch(c);
+    }
+}
+
+/* a C0 control character */
+static void control(char c)
+{
+    switch (c)
+    {
+    case '\b':
+        if (term.col)
+            --term.col;
+        term.wrap_pending = 0;
+        break;
+    case '\t':
+        term.col = (term.col / TERM_TAB_WIDTH + 1) * TERM_TAB_WIDTH;
+        if (term.col >= TEXT_GRID_COLS)
+            term.col = TEXT_GRID_COLS - 1;
+        break;
+    case '\n':
+    case '\v':
+    case '\f':
+        lineFeed();
+        term.wrap_pending = 0;
+        break;
+    case '\r':
+        term.col = 0;
+        term.wrap_pending = 0;
+        break;
+    case 0x1b:
+        term.state = TERM_ESC;
+        break;
+    default:
+        break;
+    }
+}
+
+/* run count bytes through the terminal */
+void TerminalWrite(const char* data, unsigned int count)
+{
+    const char* end = data + count;
+
+    while (data < end)
+    {
+        char c = *data++;
+
+        if (c == 0x18 || c == 0x1a)
+        {
+            /* CAN and SUB abort a sequence */
+            term.state = TERM_NORMAL;
+            continue;
+        }
+        if ((unsigned char)c < 0x20)
+        {
+            control(c);
+            continue;
+        }
+
+        switch (term.state)
+        {
+        case TERM_ESC:
+            escDispatch(c);
+            continue;
+        case TERM_CSI:
+            csiByte(c);
+            continue;
+        case TERM_SKIP:
+            term.state = TERM_NORMAL;
+            continue;
+        default:
+            break;
+        }
+
+        /* a run of printable characters goes straight into the grid */
+        for (;;)
+        {
+            if (term.wrap_pending)
+            {
+                term.col = 0;
+                lineFeed();
+                term.wrap_pending = 0;
+            }
+            /* DEL and anything above ASCII has no glyph */
+            TextGridPutChar(term.col, term.row, (unsigned char)c >= 0x7f ? ' ' : c, term.attr);
+            if (term.col == TEXT_GRID_COLS - 1)
+                term.wrap_pending = 1;
+            else
+                ++term.col;
+
+            if (data == end || (unsigned char)*data < 0x20)
+                break;
+            c = *data++;
+        }
+    }
+}
+
+/* feed the terminal from a receive ring a batch at a time */
+unsigned int TerminalPoll(TerminalReadFunc read)
+{
+    char batch[TERMINAL_BATCH];
+    unsigned int count, total = 0;
+
+    /* drain the ring, but leave the loop a turn after a few batches */
+    do
+    {
+        count = read(TERMINAL_BATCH, batch);
+        TerminalWrite(batch, count);
+        total += count;
+    } while (count == TERMINAL_BATCH && total < 4 * TERMINAL_BATCH);
+    return total;
+}
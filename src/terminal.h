@@ -0,0 +1,46 @@
+/*
+ * Description:
+ *
+ * VT100/ANSI terminal emulator drawing into the text grid
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TERMINAL_H__
+#define __TERMINAL_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* bytes taken from a receive ring per read */
+#define TERMINAL_BATCH  64
+
+/* reads up to size bytes into buffer, returns the count read (USB_VCOMread, UARTread) */
+typedef unsigned int (*TerminalReadFunc)(unsigned int size, void* buffer);
+
+/* reset the terminal: clear the grid, home the cursor, the whole grid scrolls */
+void TerminalInit(void);
+/* run count bytes through the terminal */
+void TerminalWrite(const char* data, unsigned int count);
+/* feed the terminal from a receive ring a batch at a time, returns the bytes taken */
+unsigned int TerminalPoll(TerminalReadFunc read);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __TERMINAL_H__
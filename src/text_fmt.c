@@ -0,0 +1,47 @@
+/*
+ * Description:
+ *
+ * Decimal and string formatting into a buffer
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "text_fmt.h"
+
+/* append a string, returns the new end */
+char* FmtAppendString(char* buf, const char* s)
+{
+    while (*s)
+        *buf++ = *s++;
+    return buf;
+}
+
+/* append a decimal number, returns the new end */
+char* FmtAppendNumber(char* buf, uint32_t num)
+{
+    char digits[FMT_NUMBER_MAX];
+    unsigned int i = 0;
+
+    do
+    {
+        digits[i++] = '0' + num % 10;
+        num /= 10;
+    } while (num);
+
+    while (i)
+        *buf++ = digits[--i];
+    return buf;
+}
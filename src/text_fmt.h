@@ -0,0 +1,42 @@
+/*
+ * Description:
+ *
+ * Decimal and string formatting into a buffer, for the text reports and the
+ * numbers drawn on the glass, without the C library
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TEXT_FMT_H__
+#define __TEXT_FMT_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* longest decimal number from FmtAppendNumber() */
+#define FMT_NUMBER_MAX  10
+
+/* append a string, returns the new end */
+char* FmtAppendString(char* buf, const char* s);
+/* append a decimal number, returns the new end */
+char* FmtAppendNumber(char* buf, uint32_t num);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __TEXT_FMT_H__
@@ -0,0 +1,204 @@
+/*
+ * Description:
+ *
+ * Retained character cell text layer. Each cell holds a character and its attributes
+ * and a dirty bit, rendering only touches the cells whose contents changed.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "text_grid.h"
+#include "simple_lcd.h"
+#include "text_fmt.h"
+
+#if TEXT_GRID_COLS > 32
+#error "the text grid dirty masks hold 32 cells a row"
+#endif
+
+/* the dirty bits of a whole row */
+#define TEXT_GRID_ROW_MASK  (TEXT_GRID_COLS == 32 ? 0xffffffffu : (1u << (TEXT_GRID_COLS % 32)) - 1)
+
+/* a character cell */
+struct TextCell
+{
+    char c;
+    uint8_t attr;
+};
+
+static struct TextCell cells[TEXT_GRID_ROWS][TEXT_GRID_COLS];
+/* a bit per cell of each row, set when the cell has to be rendered */
+static uint32_t dirty[TEXT_GRID_ROWS];
+
+/* blank every cell, the glass is taken to be blank already */
+void TextGridInit(void)
+{
+    unsigned int row, col;
+
+    for (row = 0; row < TEXT_GRID_ROWS; ++row)
+    {
+        for (col = 0; col < TEXT_GRID_COLS; ++col)
+        {
+            cells[row][col].c = ' ';
+            cells[row][col].attr = TEXT_ATTR_NORMAL;
+        }
+        dirty[row] = 0;
+    }
+}
+
+/* have every cell rendered again */
+void TextGridInvalidate(void)
+{
+    unsigned int row;
+
+    for (row = 0; row < TEXT_GRID_ROWS; ++row)
+        dirty[row] = TEXT_GRID_ROW_MASK;
+}
+
+/* set the cell at col,row, marking it dirty only if it changed */
+void TextGridPutChar(unsigned int col, unsigned int row, char c, uint8_t attr)
+{
+    struct TextCell* cell;
+
+    if (col >= TEXT_GRID_COLS || row >= TEXT_GRID_ROWS)
+        return;
+
+    cell = &cells[row][col];
+    if (cell->c == c && cell->attr == attr)
+        return;
+    cell->c = c;
+    cell->attr = attr;
+    dirty[row] |= 1ul << col;
+}
+
+/* set the cells from col,row along the row to a string */
+void TextGridPutString(unsigned int col, unsigned int row, const char* string, uint8_t attr)
+{
+    while (*string != '\0' && col < TEXT_GRID_COLS)
+        TextGridPutChar(col++, row, *string++, attr);
+}
+
+/* set the cells from col,row to a decimal number, left aligned and padded to width cells */
+void TextGridPutNumber(unsigned int col, unsigned int row, uint32_t num, unsigned int width)
+{
+    char digits[FMT_NUMBER_MAX];
+    unsigned int n = FmtAppendNumber(digits, num) - digits, i;
+
+    for (i = 0; i < n && width; ++i)
+    {
+        TextGridPutChar(col++, row, digits[i], TEXT_ATTR_NORMAL);
+        --width;
+    }
+    while (width--)
+        TextGridPutChar(col++, row, ' ', TEXT_ATTR_NORMAL);
+}
+
+/* return the character in the cell at col,row */
+char TextGridGetChar(unsigned int col, unsigned int row)
+{
+    if (col >= TEXT_GRID_COLS || row >= TEXT_GRID_ROWS)
+        return ' ';
+    return cells[row][col].c;
+}
+
+/* return the attributes of the cell at col,row */
+uint8_t TextGridGetAttr(unsigned int col, unsigned int row)
+{
+    if (col >= TEXT_GRID_COLS || row >= TEXT_GRID_ROWS)
+        return TEXT_ATTR_NORMAL;
+    return cells[row][col].attr;
+}
+
+/* copy row from to row to, or blank row to if from is out of the grid */
+static void copyRow(unsigned int to, unsigned int from)
+{
+    unsigned int col;
+
+    for (col = 0; col < TEXT_GRID_COLS; ++col)
+    {
+        if (from < TEXT_GRID_ROWS)
+            TextGridPutChar(col, to, cells[from][col].c, cells[from][col].attr);
+        else
+            TextGridPutChar(col, to, ' ', TEXT_ATTR_NORMAL);
+    }
+}
+
+/* scroll rows top..bottom up by n rows (down if n is negative), the rows scrolled in are blanked */
+void TextGridScroll(unsigned int top, unsigned int bottom, int n)
+{
+    unsigned int row;
+
+    if (bottom >= TEXT_GRID_ROWS)
+        bottom = TEXT_GRID_ROWS - 1;
+    if (top > bottom || !n)
+        return;
+
+    /* cells only go dirty where the text actually differs */
+    if (n > 0)
+    {
+        for (row = top; row <= bottom; ++row)
+            copyRow(row, row + n <= bottom ? row + n : TEXT_GRID_ROWS);
+    }
+    else
+    {
+        for (row = bottom + 1; row-- > top; )
+            copyRow(row, row >= top + (unsigned int)-n ? row + n : TEXT_GRID_ROWS);
+    }
+}
+
+/* render the cells changed since the last call */
+unsigned int TextGridRender(struct TextGridBounds* bounds)
+{
+    unsigned int row, col, count = 0;
+    unsigned int col0 = TEXT_GRID_COLS, col1 = 0, row0 = TEXT_GRID_ROWS, row1 = 0;
+
+    for (row = 0; row < TEXT_GRID_ROWS; ++row)
+    {
+        uint32_t bits = dirty[row];
+
+        if (!bits)
+            continue;
+        dirty[row] = 0;
+
+        for (col = 0; bits; ++col, bits >>= 1)
+        {
+            if (!(bits & 1))
+                continue;
+            RenderGlyph(TEXT_GRID_LEFT + col * TEXT_CELL_WIDTH, TEXT_GRID_TOP + row * TEXT_CELL_HEIGHT,
+                        cells[row][col].c, cells[row][col].attr & TEXT_ATTR_INVERSE);
+            ++count;
+            if (col < col0)
+                col0 = col;
+            if (col > col1)
+                col1 = col;
+        }
+        if (row < row0)
+            row0 = row;
+        row1 = row;
+    }
+
+    if (bounds)
+    {
+        bounds->x = bounds->y = bounds->w = bounds->h = 0;
+        if (count)
+        {
+            bounds->x = TEXT_GRID_LEFT + col0 * TEXT_CELL_WIDTH;
+            bounds->y = TEXT_GRID_TOP + row0 * TEXT_CELL_HEIGHT;
+            bounds->w = (col1 - col0 + 1) * TEXT_CELL_WIDTH;
+            bounds->h = (row1 - row0) * TEXT_CELL_HEIGHT + 8;
+        }
+    }
+    return count;
+}
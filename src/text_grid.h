@@ -0,0 +1,74 @@
+/*
+ * Description:
+ *
+ * Retained character cell text layer drawn through simple_lcd, only changed cells are rendered
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __TEXT_GRID_H__
+#define __TEXT_GRID_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "glassLayout.h"
+
+/* the grid's top left pixel and cell pitch, glyphs are 8x8 */
+#define TEXT_GRID_LEFT      10
+#define TEXT_GRID_TOP       0
+#define TEXT_CELL_WIDTH     8
+#define TEXT_CELL_HEIGHT    10
+
+/* cells that fit on the glass, at most 32 across for the dirty bit masks */
+#define TEXT_GRID_COLS      ((LCD_USABLE_PIXELS_PER_ROW - TEXT_GRID_LEFT) / TEXT_CELL_WIDTH)
+#define TEXT_GRID_ROWS      ((LCD_LINES - TEXT_GRID_TOP - 8) / TEXT_CELL_HEIGHT + 1)
+
+/* cell attributes */
+#define TEXT_ATTR_NORMAL    0x00
+#define TEXT_ATTR_INVERSE   0x01
+
+/* pixel bounds of the cells rendered */
+struct TextGridBounds
+{
+    unsigned int x, y, w, h;
+};
+
+/* blank every cell, the glass is taken to be blank already */
+void TextGridInit(void);
+/* have every cell rendered again, after something else drew over the grid */
+void TextGridInvalidate(void);
+/* set the cell at col,row */
+void TextGridPutChar(unsigned int col, unsigned int row, char c, uint8_t attr);
+/* set the cells from col,row along the row to a string, stopping at the edge of the grid */
+void TextGridPutString(unsigned int col, unsigned int row, const char* string, uint8_t attr);
+/* set the cells from col,row to a decimal number, left aligned and padded with spaces to width cells */
+void TextGridPutNumber(unsigned int col, unsigned int row, uint32_t num, unsigned int width);
+/* return the character in the cell at col,row */
+char TextGridGetChar(unsigned int col, unsigned int row);
+/* return the attributes of the cell at col,row */
+uint8_t TextGridGetAttr(unsigned int col, unsigned int row);
+/* scroll rows top..bottom up by n rows (down if n is negative), the rows scrolled in are blanked */
+void TextGridScroll(unsigned int top, unsigned int bottom, int n);
+/* render the cells changed since the last call, returns how many were rendered and, if bounds
+ * is not 0, the pixel bounds of them (w and h 0 when none) */
+unsigned int TextGridRender(struct TextGridBounds* bounds);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __TEXT_GRID_H__
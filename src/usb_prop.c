@@ -41,6 +41,8 @@
 #include "usb_prop.h"
 #include "usb_desc.h"
 #include "usb_pwr.h"
+#include "usb_vcom.h"
+#include "boot_timeline.h"
 
 
 uint8_t Request = 0;
@@ -139,6 +141,9 @@ void Virtual_Com_Port_init(void)
  *******************************************************************************/
 void Virtual_Com_Port_Reset(void)
 {
+    /* the host starts over, a bitmap upload it was sending will not be finished */
+    USB_VCOMUploadAbort();
+
     /* Set Virtual_Com_Port DEVICE as not configured */
     pInformation->Current_Configuration = 0;
 
@@ -213,6 +218,7 @@ void Virtual_Com_Port_SetConfiguration(void)
     {
         /* Device configured */
         bDeviceState = CONFIGURED;
+        BootTimelineMark(BOOT_USB_CONFIGURED);
     }
 }
 
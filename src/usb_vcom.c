@@ -22,7 +22,9 @@
 /*
  * USB Endpoint 1 is used to send data to the host (an IN endpoint)
  *
- * USB Endpoint 3 is used to receive data from the host (an OUT endpoint)
+ * USB Endpoint 3 is used to receive data from the host (an OUT endpoint).
+ * Bitmap uploads (see usb_vcom.h) are copied from its packet memory straight
+ * into the framebuffer, everything else goes into rx_ring.
  */
 
 #include "usb_vcom.h"
@@ -33,6 +35,8 @@
 #include "usb_pwr.h"
 #include <string.h>
 #include "ring_buffer.h"
+#include "simple_lcd.h"
+#include "systick.h"
 
 void EP1_IN_Callback(void);
 void EP3_OUT_Callback(void);
@@ -41,6 +45,33 @@ static struct RingBuffer tx_ring;
 static struct RingBuffer rx_ring;
 static int write_ready = 1;
 
+/* bitmap uploads need the packet memory and an 8-bit framebuffer to copy it into */
+#if !defined(STM32F10X_CL) && LCD_FRAMEBUFFER && LCD_FB_BPP == 8
+#define USB_VCOM_UPLOAD 1
+#else
+#define USB_VCOM_UPLOAD 0
+#endif
+
+#if USB_VCOM_UPLOAD
+/* the bitmap upload in progress, written by the EP3 interrupt */
+static struct
+{
+    uint8_t* fb;            /* the framebuffer it goes into */
+    uint8_t x, y, w, h;
+    uint8_t row;            /* the row being written */
+    uint8_t col;            /* the next pixel of that row */
+    volatile uint8_t active;
+    unsigned int last_ms;   /* when its last packet came */
+} upload;
+
+/* rows uploaded since USB_VCOMUploadPoll() last marked them dirty, inclusive bounds */
+static struct
+{
+    uint8_t x0, y0, x1, y1;
+    uint8_t valid;
+} upload_damage;
+#endif
+
 /* number of characters for the configurable descriptors (actual size is 2*(n+1) for unicode) */
 #define STRING_DESCRIPTOR_MAX_CHARS 20
 
@@ -151,12 +182,177 @@ unsigned int USB_VCOMread(unsigned int size, void* buffer)
     return GetDataFromRing(&rx_ring, size, (uint8_t*)buffer);
 }
 
+#if USB_VCOM_UPLOAD
+/* copy count bytes from byte addr of the packet memory, which holds two bytes in the low half of every word */
+static void copyFromPMA(uint8_t* to, unsigned int addr, unsigned int count)
+{
+    const volatile uint32_t* pma = (const volatile uint32_t*)(PMAAddr + (addr & ~1u) * 2);
+    uint32_t half;
+
+    if ((addr & 1) && count)
+    {
+        *to++ = *pma++ >> 8;
+        --count;
+    }
+    for (; count >= 2; count -= 2, to += 2)
+    {
+        half = *pma++;
+        to[0] = half;
+        to[1] = half >> 8;
+    }
+    if (count)
+        *to = *pma;
+}
+
+/* add a finished row of the upload to the damage */
+static void uploadRowDone(void)
+{
+    unsigned int y = upload.y + upload.row, x1 = upload.x + upload.w - 1;
+
+    if (!upload_damage.valid)
+    {
+        upload_damage.x0 = upload.x;
+        upload_damage.x1 = x1;
+        upload_damage.y0 = y;
+        upload_damage.y1 = y;
+        upload_damage.valid = 1;
+        return;
+    }
+    if (upload.x < upload_damage.x0)
+        upload_damage.x0 = upload.x;
+    if (x1 > upload_damage.x1)
+        upload_damage.x1 = x1;
+    if (y < upload_damage.y0)
+        upload_damage.y0 = y;
+    if (y > upload_damage.y1)
+        upload_damage.y1 = y;
+}
+
+/* take the upload's bytes from the count byte packet at addr of the packet memory, writing the pixels
+ * straight into the framebuffer. Returns the bytes taken, the rest of the packet is ordinary data */
+static unsigned int uploadPacket(unsigned int addr, unsigned int count)
+{
+    unsigned int used = 0, n;
+
+    if (!upload.active)
+    {
+        uint8_t header[USB_VCOM_UPLOAD_HEADER_BYTES];
+
+        if (count < USB_VCOM_UPLOAD_HEADER_BYTES)
+            return 0;
+        copyFromPMA(header, addr, USB_VCOM_UPLOAD_HEADER_BYTES);
+        if (header[0] != 0x1b || header[1] != '_' || header[2] != 'B')
+            return 0;
+
+        /* a rectangle off the glass or in a format we do not take is dropped, header and all */
+        used = USB_VCOM_UPLOAD_HEADER_BYTES;
+        if (header[3] != USB_VCOM_UPLOAD_GRAY8 || !header[6] || !header[7]
+            || header[4] + header[6] > LCD_USABLE_PIXELS_PER_ROW || header[5] + header[7] > LCD_LINES)
+            return used;
+        upload.fb = LCDGetFramebuffer();
+        upload.x = header[4];
+        upload.y = header[5];
+        upload.w = header[6];
+        upload.h = header[7];
+        upload.row = 0;
+        upload.col = 0;
+        upload.active = 1;
+    }
+
+    if (upload.active)
+        upload.last_ms = getSysTick_mSecs();
+    while (upload.active && used < count)
+    {
+        n = upload.w - upload.col;
+        if (n > count - used)
+            n = count - used;
+        copyFromPMA(upload.fb + (upload.y + upload.row) * LCD_FB_STRIDE + upload.x + upload.col, addr + used, n);
+        used += n;
+        upload.col += n;
+        if (upload.col == upload.w)
+        {
+            uploadRowDone();
+            upload.col = 0;
+            if (++upload.row == upload.h)
+                upload.active = 0;
+        }
+    }
+    return used;
+}
+#endif
+
+/* mark the rows uploaded since the last call dirty */
+int USB_VCOMUploadPoll(void)
+{
+#if USB_VCOM_UPLOAD
+    unsigned int x0, y0, x1, y1, valid;
+
+    __disable_irq();
+    x0 = upload_damage.x0;
+    y0 = upload_damage.y0;
+    x1 = upload_damage.x1;
+    y1 = upload_damage.y1;
+    valid = upload_damage.valid;
+    upload_damage.valid = 0;
+    /* a host that stopped part way would hold the frames back for good */
+    if (upload.active && getSysTick_mSecs() - upload.last_ms > USB_VCOM_UPLOAD_TIMEOUT_MS)
+        upload.active = 0;
+    __enable_irq();
+
+    if (valid)
+        LCDMarkDirty(x0, y0, x1 - x0 + 1, y1 - y0 + 1);
+    return upload.active;
+#else
+    return 0;
+#endif
+}
+
+/* drop the upload in progress */
+void USB_VCOMUploadAbort(void)
+{
+#if USB_VCOM_UPLOAD
+    upload.active = 0;
+#endif
+}
+
+/* hold off the USB interrupt or let it in again */
+void USB_VCOMHold(int hold)
+{
+#ifdef STM32F10X_CL
+    IRQn_Type irq = OTG_FS_IRQn;
+#else
+    IRQn_Type irq = USB_LP_CAN1_RX0_IRQn;
+#endif
+
+    if (hold)
+    {
+        NVIC_DisableIRQ(irq);
+        /* the mask is in force before the caller goes on */
+        __DSB();
+        __ISB();
+    }
+    else
+        NVIC_EnableIRQ(irq);
+}
+
 /* read a full block or less in EndPoint3 every callback */
 void EP3_OUT_Callback(void)
 {
     static uint8_t buffer[VIRTUAL_COM_PORT_DATA_SIZE];
+#if USB_VCOM_UPLOAD
+    /* upload pixels go from the packet memory to the framebuffer, only other data is copied out for the ring */
+    unsigned int addr = GetEPRxAddr(ENDP3), bytes = GetEPRxCount(ENDP3);
+    unsigned int used = uploadPacket(addr, bytes);
+
+    if (used < bytes)
+    {
+        copyFromPMA(buffer, addr + used, bytes - used);
+        PutDataInRing(&rx_ring, bytes - used, buffer);
+    }
+#else
     unsigned int bytes = USB_SIL_Read(EP3_OUT, (uint8_t*)buffer);
     PutDataInRing(&rx_ring, bytes, buffer);
+#endif
 #ifndef STM32F10X_CL
     /* Enable the receive of data on EP3 */
     SetEPRxValid(ENDP3);
@@ -174,6 +370,12 @@ void USB_VCOMwrite(unsigned int size, void* buffer)
     }
 }
 
+/* return the free space of the transmit ring */
+unsigned int USB_VCOMwriteFree(void)
+{
+    return GetFreeInRing(&tx_ring);
+}
+
 /* write a full block or less out EndPoint1 every callback */
 void EP1_IN_Callback(void)
 {
@@ -35,5 +35,29 @@ void USB_VCOMinit();
 unsigned int USB_VCOMread(unsigned int size, void* buffer);
 /* write the data in buffer of the given size into the USB buffer to be transmitted */
 void USB_VCOMwrite(unsigned int size, void* buffer);
+/* return how many bytes can be written without overwriting ones not sent yet */
+unsigned int USB_VCOMwriteFree(void);
+
+/*
+ * Bitmap upload: a packet starting with the 8 byte header
+ *   0x1b '_' 'B' format x y w h
+ * is followed by w * h pixel bytes, row after row, in that and the following packets. They are
+ * written from the endpoint's packet memory straight into the framebuffer instead of the read ring,
+ * the host must start the header on a packet of its own (a separate write). The only format is
+ * USB_VCOM_UPLOAD_GRAY8, controller gray bytes. Needs an 8-bit framebuffer, otherwise the header is
+ * read as ordinary data. An upload that gets no packet for USB_VCOM_UPLOAD_TIMEOUT_MS, or is cut off by
+ * a USB reset, is dropped with the rows it has written so far, whatever of it follows is ordinary data.
+ */
+#define USB_VCOM_UPLOAD_HEADER_BYTES    8
+#define USB_VCOM_UPLOAD_GRAY8           0
+#define USB_VCOM_UPLOAD_TIMEOUT_MS      250
+
+/* mark the uploaded rows dirty so the next push sends them, returns non-zero while an upload is part way */
+int USB_VCOMUploadPoll(void);
+/* drop the upload in progress, on a USB reset */
+void USB_VCOMUploadAbort(void);
+/* hold off the USB interrupt (non-zero) or let it in again, so no packet, and no upload header, is taken
+ * in between */
+void USB_VCOMHold(int hold);
 
 #endif
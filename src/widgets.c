@@ -0,0 +1,377 @@
+/*
+ * Description:
+ *
+ * Retained mode widgets. Setting a widget's state marks it dirty and its
+ * ancestors as having a dirty child, so drawing walks only the branches that
+ * changed and an idle tree costs one flag test.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+#include "widgets.h"
+#include "chart.h"
+#include "lcd_draw.h"
+#include "simple_lcd.h"
+#include "st7529_core.h"
+#include "text_fmt.h"
+
+/* copy a label's text, cut to fit. Returns non-zero if it changed */
+static int copyText(char* to, const char* from)
+{
+    int changed = 0;
+    unsigned int i;
+
+    for (i = 0; i < WIDGET_TEXT_MAX - 1 && from[i] != '\0'; ++i)
+    {
+        changed |= to[i] != from[i];
+        to[i] = from[i];
+    }
+    changed |= to[i] != '\0';
+    to[i] = '\0';
+    return changed;
+}
+
+/* set up the fields every widget has */
+static void initWidget(struct Widget* widget, uint8_t type, int x, int y, unsigned int w, unsigned int h)
+{
+    memset(widget, 0, sizeof(*widget));
+    widget->type = type;
+    widget->x = x;
+    widget->y = y;
+    widget->w = w;
+    widget->h = h;
+    widget->flags = WIDGET_DIRTY;
+}
+
+/* set up a blank w x h panel at x,y */
+void WidgetInitPanel(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, int framed)
+{
+    initWidget(widget, WIDGET_PANEL, x, y, w, h);
+    if (framed)
+        widget->flags |= WIDGET_FRAMED;
+}
+
+/* set up a w x h label at x,y */
+void WidgetInitLabel(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                     const char* text)
+{
+    initWidget(widget, WIDGET_LABEL, x, y, w, h);
+    widget->font = font;
+    copyText(widget->u.text, text);
+}
+
+/* set up a w x h value field at x,y */
+void WidgetInitValue(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                     uint32_t value)
+{
+    initWidget(widget, WIDGET_VALUE, x, y, w, h);
+    widget->font = font;
+    widget->u.value = value;
+}
+
+/* set up a w x h bar at x,y */
+void WidgetInitBar(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, uint16_t value, uint16_t max)
+{
+    initWidget(widget, WIDGET_BAR, x, y, w, h);
+    widget->u.bar.max = max ? max : 1;
+    widget->u.bar.value = value < widget->u.bar.max ? value : widget->u.bar.max;
+}
+
+/* set up an icon at x,y */
+void WidgetInitIcon(struct Widget* widget, int x, int y, const struct Image* image)
+{
+    initWidget(widget, WIDGET_ICON, x, y, image->width, image->height);
+    widget->u.image = image;
+}
+
+/* set up a w x h list at x,y */
+void WidgetInitList(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                    const char* const* items, unsigned int count)
+{
+    initWidget(widget, WIDGET_LIST, x, y, w, h);
+    widget->font = font;
+    widget->u.list.items = items;
+    widget->u.list.count = count;
+}
+
+/* add child as the last child of parent */
+void WidgetAdd(struct Widget* parent, struct Widget* child)
+{
+    struct Widget** link = &parent->child;
+
+    while (*link)
+        link = &(*link)->next;
+    *link = child;
+    child->parent = parent;
+    child->next = 0;
+    WidgetInvalidate(child);
+}
+
+/* tell the ancestors of a widget that something below them has to be drawn */
+static void markAncestors(struct Widget* widget)
+{
+    for (widget = widget->parent; widget && !(widget->flags & WIDGET_CHILD_DIRTY); widget = widget->parent)
+        widget->flags |= WIDGET_CHILD_DIRTY;
+}
+
+/* have a widget drawn again */
+void WidgetInvalidate(struct Widget* widget)
+{
+    widget->flags |= WIDGET_DIRTY;
+    markAncestors(widget);
+}
+
+/* have only what was added to a widget drawn */
+void WidgetUpdate(struct Widget* widget)
+{
+    widget->flags |= WIDGET_UPDATE;
+    markAncestors(widget);
+}
+
+/* show or hide a widget */
+void WidgetSetVisible(struct Widget* widget, int visible)
+{
+    if (!visible == !!(widget->flags & WIDGET_HIDDEN))
+        return;
+    widget->flags ^= WIDGET_HIDDEN;
+    WidgetInvalidate(widget);
+}
+
+/* set a label's text */
+void WidgetSetText(struct Widget* widget, const char* text)
+{
+    if (copyText(widget->u.text, text))
+        WidgetInvalidate(widget);
+}
+
+/* set the number of a value field or the value of a bar */
+void WidgetSetValue(struct Widget* widget, uint32_t value)
+{
+    if (widget->type == WIDGET_BAR)
+    {
+        if (value > widget->u.bar.max)
+            value = widget->u.bar.max;
+        if (value == widget->u.bar.value)
+            return;
+        widget->u.bar.value = value;
+    }
+    else
+    {
+        if (value == widget->u.value)
+            return;
+        widget->u.value = value;
+    }
+    WidgetInvalidate(widget);
+}
+
+/* set the selected item of a list */
+void WidgetSetSelected(struct Widget* widget, unsigned int selected)
+{
+    if (selected >= widget->u.list.count || selected == widget->u.list.selected)
+        return;
+    widget->u.list.selected = selected;
+    WidgetInvalidate(widget);
+}
+
+/* draw text in a w x h box at x,y, left or right aligned, cut off at the edge of the box. The rest of the
+ * box is filled with the paper */
+static void drawText(int x, int y, unsigned int w, unsigned int h, const struct Font* font, const char* text,
+                     int right, uint8_t ink, uint8_t paper)
+{
+    unsigned int width = FontStringWidth(font, text);
+    unsigned int lines = font->height < h ? font->height : h;
+    int pen = x, end = x + (int)w;
+
+    if (right && width < w)
+    {
+        pen = end - (int)width;
+        DrawFillRect(x, y, pen - x, lines, paper);
+    }
+
+    FontSetColors(ink, paper);
+    for (; *text != '\0' && pen + (int)FontCharWidth(font, *text) <= end; ++text)
+        pen += FontDrawChar(font, pen, y, *text);
+    FontSetColors(BLACK, WHITE);
+
+    DrawFillRect(pen, y, end - pen, lines, paper);
+    if (h > lines)
+        DrawFillRect(x, y + lines, w, h - lines, paper);
+}
+
+/* draw a list, scrolled to keep the selected item in view */
+static void drawList(struct Widget* widget)
+{
+    unsigned int lines = widget->h / widget->font->height, line;
+
+    if (!lines)
+        lines = 1;
+    if (widget->u.list.selected < widget->u.list.first)
+        widget->u.list.first = widget->u.list.selected;
+    else if (widget->u.list.selected >= widget->u.list.first + lines)
+        widget->u.list.first = widget->u.list.selected - lines + 1;
+
+    for (line = 0; line < lines; ++line)
+    {
+        unsigned int item = widget->u.list.first + line;
+        int y = widget->y + line * widget->font->height;
+
+        if (item < widget->u.list.count)
+        {
+            int selected = item == widget->u.list.selected;
+            drawText(widget->x, y, widget->w, widget->font->height, widget->font, widget->u.list.items[item], 0,
+                     selected ? WHITE : BLACK, selected ? BLACK : WHITE);
+        }
+        else
+            DrawFillRect(widget->x, y, widget->w, widget->font->height, WHITE);
+    }
+    if (widget->h > lines * widget->font->height)
+        DrawFillRect(widget->x, widget->y + lines * widget->font->height, widget->w,
+                     widget->h - lines * widget->font->height, WHITE);
+}
+
+/* draw one widget over its whole box */
+static void drawWidget(struct Widget* widget)
+{
+    char number[FMT_NUMBER_MAX + 1];
+    unsigned int fill;
+
+    if (widget->flags & WIDGET_HIDDEN)
+    {
+        DrawFillRect(widget->x, widget->y, widget->w, widget->h, WHITE);
+        return;
+    }
+
+    switch (widget->type)
+    {
+    case WIDGET_PANEL:
+        DrawFillRect(widget->x, widget->y, widget->w, widget->h, WHITE);
+        if (widget->flags & WIDGET_FRAMED)
+            DrawRect(widget->x, widget->y, widget->w, widget->h, BLACK);
+        break;
+    case WIDGET_LABEL:
+        drawText(widget->x, widget->y, widget->w, widget->h, widget->font, widget->u.text, 0, BLACK, WHITE);
+        break;
+    case WIDGET_VALUE:
+        *FmtAppendNumber(number, widget->u.value) = '\0';
+        drawText(widget->x, widget->y, widget->w, widget->h, widget->font, number, 1, BLACK, WHITE);
+        break;
+    case WIDGET_BAR:
+        if (widget->w < 3 || widget->h < 3)
+            break;
+        fill = (widget->w - 2) * widget->u.bar.value / widget->u.bar.max;
+        DrawRect(widget->x, widget->y, widget->w, widget->h, BLACK);
+        DrawFillRect(widget->x + 1, widget->y + 1, fill, widget->h - 2, BLACK);
+        DrawFillRect(widget->x + 1 + fill, widget->y + 1, widget->w - 2 - fill, widget->h - 2, WHITE);
+        break;
+    case WIDGET_ICON:
+        ImageDraw(widget->u.image, widget->x, widget->y);
+        break;
+    case WIDGET_LIST:
+        drawList(widget);
+        break;
+    case WIDGET_CHART:
+        ChartDraw(widget->u.chart, 1);
+        break;
+    }
+}
+
+/* add a widget's box to the damage, the part of it off the glass is left out */
+static void addDamage(struct WidgetBounds* damage, const struct Widget* widget)
+{
+    unsigned int x0, y0, x1, y1;
+
+    if (widget->x + (int)widget->w <= 0 || widget->y + (int)widget->h <= 0 || !widget->w || !widget->h ||
+        widget->x >= LCD_USABLE_PIXELS_PER_ROW || widget->y >= LCD_LINES)
+        return;
+    x0 = widget->x < 0 ? 0 : widget->x;
+    y0 = widget->y < 0 ? 0 : widget->y;
+    x1 = widget->x + widget->w;
+    y1 = widget->y + widget->h;
+    if (x1 > LCD_USABLE_PIXELS_PER_ROW)
+        x1 = LCD_USABLE_PIXELS_PER_ROW;
+    if (y1 > LCD_LINES)
+        y1 = LCD_LINES;
+
+    if (damage->w)
+    {
+        x0 = damage->x < x0 ? damage->x : x0;
+        y0 = damage->y < y0 ? damage->y : y0;
+        x1 = damage->x + damage->w > x1 ? damage->x + damage->w : x1;
+        y1 = damage->y + damage->h > y1 ? damage->y + damage->h : y1;
+    }
+    damage->x = x0;
+    damage->y = y0;
+    damage->w = x1 - x0;
+    damage->h = y1 - y0;
+}
+
+/* draw the dirty widgets of a branch, parents before their children */
+static unsigned int renderBranch(struct Widget* widget, struct WidgetBounds* damage, unsigned int drawn)
+{
+    struct Widget* child;
+
+    if (widget->flags & WIDGET_DIRTY)
+    {
+        drawWidget(widget);
+        addDamage(damage, widget);
+        ++drawn;
+        /* a blank box leaves nothing of the children, anything else was drawn over them */
+        if (widget->flags & WIDGET_HIDDEN)
+            widget->flags &= ~WIDGET_CHILD_DIRTY;
+        else if (widget->child)
+        {
+            for (child = widget->child; child; child = child->next)
+                child->flags |= WIDGET_DIRTY;
+            widget->flags |= WIDGET_CHILD_DIRTY;
+        }
+        widget->flags &= ~(WIDGET_DIRTY | WIDGET_UPDATE);
+    }
+    else if (widget->flags & WIDGET_UPDATE)
+    {
+        widget->flags &= ~WIDGET_UPDATE;
+        if (widget->type == WIDGET_CHART && !(widget->flags & WIDGET_HIDDEN))
+        {
+            ChartDraw(widget->u.chart, 0);
+            addDamage(damage, widget);
+            ++drawn;
+        }
+    }
+
+    if (widget->flags & WIDGET_CHILD_DIRTY)
+    {
+        widget->flags &= ~WIDGET_CHILD_DIRTY;
+        if (!(widget->flags & WIDGET_HIDDEN))
+            for (child = widget->child; child; child = child->next)
+                if (child->flags & (WIDGET_DIRTY | WIDGET_UPDATE | WIDGET_CHILD_DIRTY))
+                    drawn = renderBranch(child, damage, drawn);
+    }
+    return drawn;
+}
+
+/* draw the widgets of the tree under root that changed */
+unsigned int WidgetRender(struct Widget* root, struct WidgetBounds* damage)
+{
+    struct WidgetBounds bounds;
+
+    if (!damage)
+        damage = &bounds;
+    damage->x = damage->y = damage->w = damage->h = 0;
+
+    if (!(root->flags & (WIDGET_DIRTY | WIDGET_UPDATE | WIDGET_CHILD_DIRTY)))
+        return 0;
+    return renderBranch(root, damage, 0);
+}
@@ -0,0 +1,128 @@
+/*
+ * Description:
+ *
+ * Retained mode widgets: a tree of labels, values, bars, icons, lists and charts that
+ * redraws only the widgets whose state changed
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __WIDGETS_H__
+#define __WIDGETS_H__
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "font.h"
+#include "image.h"
+
+/* the longest label text, with its terminator */
+#define WIDGET_TEXT_MAX     24
+
+/* widget types */
+#define WIDGET_PANEL        0   /* a blank box holding other widgets */
+#define WIDGET_LABEL        1   /* a line of text, left aligned */
+#define WIDGET_VALUE        2   /* a decimal number, right aligned */
+#define WIDGET_BAR          3   /* a framed bar filled in proportion to a value */
+#define WIDGET_ICON         4   /* an image */
+#define WIDGET_LIST         5   /* lines of text with one selected, scrolled to keep it in view */
+#define WIDGET_CHART        6   /* a scrolling plot of samples, see chart.h */
+
+/* widget flags */
+#define WIDGET_DIRTY        0x01    /* the widget has to be drawn again */
+#define WIDGET_CHILD_DIRTY  0x02    /* a widget below this one has to be drawn again */
+#define WIDGET_HIDDEN       0x04    /* the widget and the ones below it are not drawn, their box is blank */
+#define WIDGET_FRAMED       0x08    /* a panel with a one pixel frame */
+#define WIDGET_UPDATE       0x10    /* only what was added to the widget has to be drawn */
+
+struct Chart;
+
+/* a widget, owned by the caller. Siblings must not overlap, children are drawn over their parent */
+struct Widget
+{
+    struct Widget* parent;
+    struct Widget* child;       /* the first child */
+    struct Widget* next;        /* the next sibling */
+    int16_t x, y;
+    uint16_t w, h;
+    uint8_t type;
+    uint8_t flags;
+    const struct Font* font;
+    union
+    {
+        char text[WIDGET_TEXT_MAX];
+        uint32_t value;
+        struct
+        {
+            uint16_t value;
+            uint16_t max;
+        } bar;
+        const struct Image* image;
+        struct Chart* chart;
+        struct
+        {
+            const char* const* items;
+            unsigned int count;
+            unsigned int selected;
+            unsigned int first; /* the item on the top line */
+        } list;
+    } u;
+};
+
+/* pixel bounds of the widgets drawn */
+struct WidgetBounds
+{
+    unsigned int x, y, w, h;
+};
+
+/* set up a blank w x h panel at x,y, framed or not */
+void WidgetInitPanel(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, int framed);
+/* set up a w x h label at x,y */
+void WidgetInitLabel(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                     const char* text);
+/* set up a w x h value field at x,y */
+void WidgetInitValue(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                     uint32_t value);
+/* set up a w x h bar at x,y, showing value out of max */
+void WidgetInitBar(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, uint16_t value, uint16_t max);
+/* set up an icon at x,y, the size of its image */
+void WidgetInitIcon(struct Widget* widget, int x, int y, const struct Image* image);
+/* set up a w x h list at x,y of count items, a line of the font each */
+void WidgetInitList(struct Widget* widget, int x, int y, unsigned int w, unsigned int h, const struct Font* font,
+                    const char* const* items, unsigned int count);
+/* add child as the last child of parent */
+void WidgetAdd(struct Widget* parent, struct Widget* child);
+/* have a widget and the widgets below it drawn again */
+void WidgetInvalidate(struct Widget* widget);
+/* have only what was added to a widget drawn, for widgets that can draw just that */
+void WidgetUpdate(struct Widget* widget);
+/* show or hide a widget */
+void WidgetSetVisible(struct Widget* widget, int visible);
+/* set a label's text, it is drawn again only if the text changed */
+void WidgetSetText(struct Widget* widget, const char* text);
+/* set the number of a value field or the value of a bar, drawn again only if it changed */
+void WidgetSetValue(struct Widget* widget, uint32_t value);
+/* set the selected item of a list, drawn again only if it changed */
+void WidgetSetSelected(struct Widget* widget, unsigned int selected);
+/* draw the widgets of the tree under root that changed, returns the number drawn and the union of their
+ * bounds on the glass in damage (if not 0), empty when nothing changed */
+unsigned int WidgetRender(struct Widget* root, struct WidgetBounds* damage);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // __WIDGETS_H__
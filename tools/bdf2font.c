@@ -0,0 +1,298 @@
+/*
+ * Description:
+ *
+ * Host tool: convert a BDF bitmap font to the packed or run length encoded
+ * font format of src/font.h, written out as C source.
+ *
+ *   cc -o bdf2font bdf2font.c
+ *   ./bdf2font [-r|-p] [-b bpp] [-f first] [-l last] name < font.bdf > name.c
+ *
+ *   -r     run length encode the glyphs
+ *   -p     pack the glyphs pixel after pixel
+ *          (default: whichever is smaller)
+ *   -b     coverage bits per pixel of the font made, 1, 2 or 4
+ *          (default: the BDF font's, 8 bit fonts are made 4 bit)
+ *   -f -l  the range of characters to keep, 32 to 126 by default
+ *
+ * Every glyph is placed in a cell FONT_ASCENT + FONT_DESCENT rows high, at most
+ * 32 pixels wide. The cell width is the glyph's DWIDTH, so proportional fonts
+ * stay proportional. Anti-aliased fonts are read from BDF 2.3 files giving the
+ * bits per pixel as the fourth SIZE field.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_WIDTH   32
+#define MAX_HEIGHT  24
+#define MAX_CHARS   256
+
+struct Glyph
+{
+    int present;
+    int width;
+    uint8_t pixels[MAX_HEIGHT][MAX_WIDTH];  /* coverage, 0 to 2^bpp - 1 */
+};
+
+static struct Glyph glyphs[MAX_CHARS];
+static int ascent = -1, descent = -1, height;
+/* bits per pixel of the BDF font read and of the font made */
+static int bdf_bpp = 1, bpp;
+
+/* the stream of output bytes for one encoding */
+struct Out
+{
+    uint8_t* bytes;
+    unsigned int count, size;
+};
+
+static void put(struct Out* out, uint8_t b)
+{
+    if (out->count == out->size)
+    {
+        out->size = out->size ? out->size * 2 : 1024;
+        out->bytes = realloc(out->bytes, out->size);
+        if (!out->bytes)
+        {
+            fprintf(stderr, "bdf2font: out of memory\n");
+            exit(1);
+        }
+    }
+    out->bytes[out->count++] = b;
+}
+
+/* the pixels of glyph g row after row, bpp bits each, MSB first, the last byte padded */
+static void encodePacked(struct Out* out, const struct Glyph* g)
+{
+    int row, col, n = 0;
+    uint8_t b = 0;
+
+    for (row = 0; row < height; ++row)
+    {
+        for (col = 0; col < g->width; ++col)
+        {
+            b = (b << bpp) | g->pixels[row][col];
+            n += bpp;
+            if (n == 8)
+            {
+                put(out, b);
+                b = 0;
+                n = 0;
+            }
+        }
+    }
+    if (n)
+        put(out, b << (8 - n));
+}
+
+/* runs over the same pixels, the coverage in the top bpp bits of a byte, the length - 1 below */
+static void encodeRLE(struct Out* out, const struct Glyph* g)
+{
+    int row, col, level = -1, run = 0, longest = 1 << (8 - bpp);
+
+    for (row = 0; row < height; ++row)
+    {
+        for (col = 0; col < g->width; ++col)
+        {
+            int p = g->pixels[row][col];
+            if (p != level || run == longest)
+            {
+                if (run)
+                    put(out, (level << (8 - bpp)) | (run - 1));
+                level = p;
+                run = 0;
+            }
+            ++run;
+        }
+    }
+    if (run)
+        put(out, (level << (8 - bpp)) | (run - 1));
+}
+
+/* a BDF pixel value scaled to the coverage levels of the font made */
+static int requantize(int value)
+{
+    int from = (1 << bdf_bpp) - 1, to = (1 << bpp) - 1;
+    return (value * to + from / 2) / from;
+}
+
+/* read the BDF font from f */
+static void readBDF(FILE* f)
+{
+    char line[256];
+    int encoding = -1, dwidth = 0, bbw = 0, bbh = 0, bbx = 0, bby = 0, row = -1;
+
+    while (fgets(line, sizeof(line), f))
+    {
+        if (!strncmp(line, "SIZE ", 5))
+        {
+            int size, xres, yres;
+            if (sscanf(line + 5, "%d %d %d %d", &size, &xres, &yres, &bdf_bpp) < 4)
+                bdf_bpp = 1;
+            if (bdf_bpp != 1 && bdf_bpp != 2 && bdf_bpp != 4 && bdf_bpp != 8)
+            {
+                fprintf(stderr, "bdf2font: %d bits per pixel is not supported\n", bdf_bpp);
+                exit(1);
+            }
+        }
+        else if (!strncmp(line, "FONT_ASCENT ", 12))
+            ascent = atoi(line + 12);
+        else if (!strncmp(line, "FONT_DESCENT ", 13))
+            descent = atoi(line + 13);
+        else if (!strncmp(line, "ENCODING ", 9))
+            encoding = atoi(line + 9);
+        else if (!strncmp(line, "DWIDTH ", 7))
+            dwidth = atoi(line + 7);
+        else if (!strncmp(line, "BBX ", 4))
+            sscanf(line + 4, "%d %d %d %d", &bbw, &bbh, &bbx, &bby);
+        else if (!strncmp(line, "BITMAP", 6))
+        {
+            if (ascent < 0 || descent < 0)
+            {
+                fprintf(stderr, "bdf2font: FONT_ASCENT and FONT_DESCENT must come before the glyphs\n");
+                exit(1);
+            }
+            height = ascent + descent;
+            if (!bpp)
+                bpp = bdf_bpp > 4 ? 4 : bdf_bpp;
+            if (height > MAX_HEIGHT)
+            {
+                fprintf(stderr, "bdf2font: fonts may be at most %d rows high\n", MAX_HEIGHT);
+                exit(1);
+            }
+            row = 0;
+            if (encoding >= 0 && encoding < MAX_CHARS)
+            {
+                memset(&glyphs[encoding], 0, sizeof(glyphs[encoding]));
+                glyphs[encoding].present = 1;
+                glyphs[encoding].width = dwidth > MAX_WIDTH ? MAX_WIDTH : dwidth;
+            }
+        }
+        else if (!strncmp(line, "ENDCHAR", 7))
+        {
+            row = -1;
+            encoding = -1;
+        }
+        else if (row >= 0 && encoding >= 0 && encoding < MAX_CHARS)
+        {
+            /* a bitmap row, bdf_bpp bits per pixel, placed in the cell by the bounding box */
+            int digits = (int)strspn(line, "0123456789abcdefABCDEF");
+            int cell_row = ascent - (bby + bbh) + row;
+            int col;
+
+            for (col = 0; col < bbw && col < digits * 4 / bdf_bpp; ++col)
+            {
+                int x = bbx + col, bit = col * bdf_bpp;
+                int digit = line[bit / 4], value;
+
+                digit = digit <= '9' ? digit - '0' : (digit | 0x20) - 'a' + 10;
+                if (bdf_bpp == 8)
+                {
+                    int low = line[bit / 4 + 1];
+                    value = (digit << 4) | (low <= '9' ? low - '0' : (low | 0x20) - 'a' + 10);
+                }
+                else
+                    value = (digit >> (4 - bdf_bpp - bit % 4)) & ((1 << bdf_bpp) - 1);
+
+                if (x >= 0 && x < MAX_WIDTH && cell_row >= 0 && cell_row < height)
+                    glyphs[encoding].pixels[cell_row][x] = requantize(value);
+            }
+            ++row;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    struct Out packed = { 0 }, rle = { 0 }, *out;
+    unsigned int offsets[MAX_CHARS];
+    const char* name = 0;
+    int mode = 0, first = 32, last = 126, c, i;
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-r"))
+            mode = 'r';
+        else if (!strcmp(argv[i], "-p"))
+            mode = 'p';
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+            bpp = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-f") && i + 1 < argc)
+            first = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-l") && i + 1 < argc)
+            last = atoi(argv[++i]);
+        else
+            name = argv[i];
+    }
+    if (!name || first < 0 || last >= MAX_CHARS || first > last || (bpp && bpp != 1 && bpp != 2 && bpp != 4))
+    {
+        fprintf(stderr, "usage: bdf2font [-r|-p] [-b bpp] [-f first] [-l last] name < font.bdf > name.c\n");
+        return 1;
+    }
+
+    readBDF(stdin);
+    if (!height)
+    {
+        fprintf(stderr, "bdf2font: no glyphs\n");
+        return 1;
+    }
+
+    for (c = first; c <= last; ++c)
+    {
+        encodePacked(&packed, &glyphs[c]);
+        encodeRLE(&rle, &glyphs[c]);
+    }
+    if (!mode)
+        mode = rle.count < packed.count ? 'r' : 'p';
+    out = mode == 'r' ? &rle : &packed;
+
+    /* again for the offsets of the encoding chosen */
+    out->count = 0;
+    for (c = first; c <= last; ++c)
+    {
+        offsets[c] = out->count;
+        if (mode == 'r')
+            encodeRLE(out, &glyphs[c]);
+        else
+            encodePacked(out, &glyphs[c]);
+    }
+    if (out->count > 0xffff)
+    {
+        fprintf(stderr, "bdf2font: more than 64KB of glyph data\n");
+        return 1;
+    }
+
+    printf("/*\n * Description:\n *\n * Font %s, %d rows, characters %d to %d, %d bit%s per pixel, %s.\n", name, height,
+           first, last, bpp, bpp > 1 ? "s" : "", mode == 'r' ? "run length encoded" : "packed");
+    printf(" * Generated by tools/bdf2font, do not edit.\n */\n");
+    printf("#include \"font.h\"\n\n");
+    printf("static const uint8_t %s_bits[%u] = {", name, out->count);
+    for (i = 0; i < (int)out->count; ++i)
+        printf("%s0x%02x,", i % 12 ? " " : "\n    ", out->bytes[i]);
+    printf("\n};\n\n");
+    printf("static const struct FontGlyph %s_glyphs[%d] = {\n", name, last - first + 1);
+    for (c = first; c <= last; ++c)
+        printf("    { %5u, %2d },   /* %3d %c */\n", offsets[c], glyphs[c].width,
+               c, c >= 32 && c < 127 && c != '\\' ? c : ' ');
+    printf("};\n\n");
+    printf("const struct Font %s = {\n    %d, %d, %d, %s, %d, %s_glyphs, %s_bits\n};\n", name, height, first,
+           last - first + 1, mode == 'r' ? "FONT_RLE" : "FONT_PACKED", bpp, name, name);
+    return 0;
+}
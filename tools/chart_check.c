@@ -0,0 +1,219 @@
+/*
+ * Description:
+ *
+ * Host check: feed a chart widget of src/chart.c a noisy signal at 100 samples/s
+ * and render it at 30 frames/s, and after every frame check the plot that was
+ * shifted in place against a full redraw, and the autoscale range against the
+ * samples on the plot. Then time the frames both ways. The damage WidgetRender()
+ * reports for widgets hanging off the glass is checked first.
+ *
+ *   make chart_check && ./chart_check
+ *
+ * The controller is modelled by lcd_model.c. The times are the host's.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "simple_lcd.h"
+#include "lcd_config.h"
+#include "widgets.h"
+#include "chart.h"
+
+#define SAMPLE_RATE     100
+#define FRAME_RATE      30
+/* frames checked, and timed */
+#define CHECK_FRAMES    3000
+#define TIME_FRAMES     30000
+
+static uint8_t full[LCD_FB_BYTE_CNT];
+
+static unsigned int failures, checks;
+
+#define CHECK(COND, ...) do { ++checks; if (!(COND)) { ++failures; printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+    printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+static struct Widget root;
+static struct Chart chart;
+
+static double seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* a random walk, with a step now and then to force a rescale */
+static int16_t nextSample(void)
+{
+    static int value;
+
+    value += rand() % 21 - 10;
+    if (rand() % 1000 == 0)
+        value += rand() % 2 ? 500 : -500;
+    if (value > 20000 || value < -20000)
+        value = 0;
+    return value;
+}
+
+/* add the samples due by the end of frame */
+static unsigned int addSamples(unsigned int frame)
+{
+    unsigned int n = (frame + 1) * SAMPLE_RATE / FRAME_RATE - frame * SAMPLE_RATE / FRAME_RATE, i;
+
+    for (i = 0; i < n; ++i)
+        ChartAddSample(&chart, nextSample());
+    return n;
+}
+
+/* the lowest and highest of the samples on the plot */
+static void plotRange(int16_t* min, int16_t* max)
+{
+    unsigned int slots = chart.columns + 1, shown = chart.count < chart.columns ? chart.count : chart.columns, i;
+
+    *min = INT16_MAX;
+    *max = INT16_MIN;
+    for (i = 0; i < shown; ++i)
+    {
+        int16_t s = chart.samples[(chart.head + 2 * slots - 1 - i) % slots];
+        if (s < *min)
+            *min = s;
+        if (s > *max)
+            *max = s;
+    }
+}
+
+static void setUp(int x, int y, unsigned int w, unsigned int h)
+{
+    LCDClear();
+    WidgetInitPanel(&root, 0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, 0);
+    ChartInit(&chart, x, y, w, h);
+    WidgetAdd(&root, &chart.widget);
+    WidgetRender(&root, 0);
+    srand(1);
+}
+
+static void run(int x, int y, unsigned int w, unsigned int h)
+{
+    unsigned int frame, updates = 0, columns = 0;
+    int16_t min, max, plot_min, plot_max;
+
+    setUp(x, y, w, h);
+    printf("chart %ux%u at %d,%d\n", chart.widget.w, chart.widget.h, x, y);
+    for (frame = 0; frame < CHECK_FRAMES; ++frame)
+    {
+        addSamples(frame);
+        if (!(chart.widget.flags & WIDGET_DIRTY) && !chart.rescale)
+        {
+            ++updates;
+            columns += chart.pending;
+        }
+        WidgetRender(&root, 0);
+
+        /* drawing it all again has to change nothing */
+        memcpy(full, LCDGetFramebuffer(), sizeof(full));
+        ChartDraw(&chart, 1);
+        CHECK(!memcmp(full, LCDGetFramebuffer(), sizeof(full)), "frame %u differs from a full redraw", frame);
+
+        ChartGetRange(&chart, &min, &max);
+        plotRange(&plot_min, &plot_max);
+        CHECK(min == plot_min && max == plot_max, "frame %u: range %d..%d, the plot holds %d..%d",
+              frame, min, max, plot_min, plot_max);
+        if (failures)
+            break;
+    }
+    /* the rest rescaled, an update of a plot off the glass is drawn whole */
+    printf("  %u of %u frames drew only the new samples, %.2f columns each\n", updates, CHECK_FRAMES,
+           updates ? (double)columns / updates : 0.0);
+}
+
+/* the damage of a panel at x,y drawn on its own, on a root with no box */
+static void checkDamage(int x, int y, unsigned int w, unsigned int h, unsigned int dx, unsigned int dy,
+                        unsigned int dw, unsigned int dh)
+{
+    struct Widget panel;
+    struct WidgetBounds damage;
+
+    LCDClear();
+    WidgetInitPanel(&root, 0, 0, 0, 0, 0);
+    WidgetInitPanel(&panel, x, y, w, h, 1);
+    WidgetAdd(&root, &panel);
+    WidgetRender(&root, 0);
+    WidgetInvalidate(&panel);
+    WidgetRender(&root, &damage);
+    CHECK(damage.x == dx && damage.y == dy && damage.w == dw && damage.h == dh,
+          "panel %ux%u at %d,%d: damage %ux%u at %u,%u, expected %ux%u at %u,%u",
+          w, h, x, y, damage.w, damage.h, damage.x, damage.y, dw, dh, dx, dy);
+}
+
+/* host time of a frame, shifting in place and drawing it all */
+static void timeFrames(int x, int y, unsigned int w, unsigned int h)
+{
+    double start, shift_s, full_s;
+    unsigned int frame;
+
+    setUp(x, y, w, h);
+    start = seconds();
+    for (frame = 0; frame < TIME_FRAMES; ++frame)
+    {
+        addSamples(frame);
+        WidgetRender(&root, 0);
+    }
+    shift_s = seconds() - start;
+
+    setUp(x, y, w, h);
+    start = seconds();
+    for (frame = 0; frame < TIME_FRAMES; ++frame)
+    {
+        addSamples(frame);
+        WidgetInvalidate(&chart.widget);
+        WidgetRender(&root, 0);
+    }
+    full_s = seconds() - start;
+
+    printf("chart %ux%u, %u samples/s at %u frames/s: %.2fus a frame shifted, %.2fus redrawn (%.1fx)\n",
+           chart.widget.w, chart.widget.h, SAMPLE_RATE, FRAME_RATE, shift_s * 1e6 / TIME_FRAMES,
+           full_s * 1e6 / TIME_FRAMES, full_s / shift_s);
+}
+
+int main(void)
+{
+    LCDInit();
+    while (LCDPoll()) ;
+
+    /* on the glass, hanging off each side, and past the right and the bottom */
+    checkDamage(10, 20, 30, 40, 10, 20, 30, 40);
+    checkDamage(-5, -6, 30, 40, 0, 0, 25, 34);
+    checkDamage(LCD_USABLE_PIXELS_PER_ROW - 10, LCD_LINES - 8, 30, 40, LCD_USABLE_PIXELS_PER_ROW - 10, LCD_LINES - 8, 10, 8);
+    checkDamage(-5, -6, LCD_USABLE_PIXELS_PER_ROW + 10, LCD_LINES + 12, 0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES);
+    checkDamage(LCD_USABLE_PIXELS_PER_ROW, 10, 30, 40, 0, 0, 0, 0);
+    checkDamage(10, LCD_LINES + 3, 30, 40, 0, 0, 0, 0);
+
+    /* an unaligned plot, the widest on the whole height, and one hanging off the right */
+    run(13, 5, 102, 40);
+    run(0, 0, CHART_MAX_COLUMNS + 2, LCD_LINES);
+    run(200, 30, 100, 30);
+
+    timeFrames(13, 5, 102, 40);
+    timeFrames(0, 0, CHART_MAX_COLUMNS + 2, LCD_LINES);
+
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures != 0;
+}
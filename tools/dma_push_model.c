@@ -0,0 +1,363 @@
+/*
+ * Description:
+ *
+ * Host check: run the background push of src/st7529_dma.c against a register
+ * model of TIM8, DMA2 and the LCD bus pins, and check the nWR waveform the
+ * timer is set up for, the order of the bytes latched by the controller and
+ * the completion of each push.
+ *
+ *   make dma_push_model && ./dma_push_model
+ *
+ * The firmware and the StdPeriph drivers run unchanged. The peripheral and
+ * system control address ranges are mapped as plain memory and the model plays
+ * the hardware between the register writes: each timer burst is stepped period
+ * by period, the DMA channels move their words from CMAR to CPAR, and the byte
+ * on the data lines is latched at each rising nWR edge. It has to be built
+ * without PIE (see the Makefile) so the firmware's static data sits below 4GB,
+ * where its 32-bit DMA addresses reach it.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include "stm32f10x.h"
+#include "platform_config.h"
+#include "glassLayout.h"
+#include "st7529_core.h"
+#include "st7529_dma.h"
+
+/* the timer's update interrupt handler in st7529_dma.c */
+void ST7529_WR_TIM_HANDLER(void);
+
+/* controller timing the push has to meet, from the ST7529 data sheet at 3.3V */
+#define TCYC8_NS        400     // write cycle
+#define TCCLW_NS        100     // nWR low
+
+/* the nWR pin's configuration nibble in GPIOx->CRL */
+#define nWR_CRL         ((ST7529_nWR_GPIO->CRL >> (7 * 4)) & 0xf)
+#define nWR_CRL_GPIO    0x2
+#define nWR_CRL_TIMER   0xa
+
+/* most bytes a push sends: every window row with its pad */
+#define MAX_BYTES       (LCD_LINES * (LCD_USABLE_PIXELS_PER_ROW + 8))
+
+/* the glass windows, as built in st7529_core.c */
+#define GLASS_WINDOW(ROW, ROWS, LINE, COL0, COL1, PAD) \
+    { (ROW) * LCD_USABLE_PIXELS_PER_ROW, (ROW), (ROWS), (LINE), (COL0), (COL1), (PAD), \
+      ((COL1) - (COL0) + 1) * LCD_PIXELS_PER_COLUMN - (PAD) },
+const struct ST7529_GlassWindow ST7529_glassWindows[LCD_GLASS_WINDOW_COUNT] = {
+    LCD_GLASS_WINDOWS(GLASS_WINDOW)
+};
+
+/* what the model has seen on the bus */
+static struct
+{
+    int selected;                   // nCS low
+    uint8_t data;                   // level of the data lines
+    int locked;                     // LCDBusLock() state
+    unsigned int windows;           // windows addressed
+    uint8_t window_line[8];         // start line of each window addressed
+    unsigned int window_start[8];   // bytes latched before each window
+    uint8_t bytes[MAX_BYTES];       // bytes latched at the rising nWR edges
+    unsigned int count;
+    unsigned int bursts;
+    unsigned int done;              // completion callbacks
+    unsigned int done_at;           // bytes latched when the last one came
+    uint64_t ns;                    // bus time of the bursts
+} bus;
+
+/* timer clock and counts of one byte period */
+static unsigned int tim_mhz;
+
+static uint8_t fb[LCD_BUFFER_BYTE_CNT];
+static unsigned int failures, checks;
+
+#define CHECK(COND, ...) do { ++checks; if (!(COND)) { ++failures; printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+    printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* apply the pin writes the CPU made since the last look, BSRR and BRR hold the last word written */
+static void cpuPinWrites(void)
+{
+    uint32_t set = ST7529_nCS_GPIO->BSRR, clear = ST7529_nCS_GPIO->BRR;
+
+    CHECK(!((set | clear) & ST7529_nCS) || !((set & ST7529_nCS) && (clear & ST7529_nCS)),
+          "nCS both set and cleared between two looks");
+    if (set & ST7529_nCS)
+        bus.selected = 0;
+    if (clear & ST7529_nCS)
+        bus.selected = 1;
+    ST7529_nCS_GPIO->BSRR = 0;
+    ST7529_nCS_GPIO->BRR = 0;
+}
+
+/* the command bytes of a window are strobed by the CPU, not the timer */
+void ST7529_beginWindowWrite(uint8_t startLine, uint8_t endLine, uint8_t startCol, uint8_t endCol)
+{
+    cpuPinWrites();
+    CHECK(!(ST7529_WR_TIM->CR1 & TIM_CR1_CEN), "window addressed with the timer running");
+    CHECK(nWR_CRL == nWR_CRL_GPIO, "window addressed with nWR on the timer");
+    CHECK(bus.windows < 8, "too many windows");
+    if (bus.windows < 8)
+    {
+        bus.window_line[bus.windows] = startLine;
+        bus.window_start[bus.windows] = bus.count;
+        bus.windows++;
+    }
+}
+
+void LCDBusGap(void)
+{
+    cpuPinWrites();
+    CHECK(!bus.selected, "bus gap with nCS low");
+}
+
+void LCDBusLock(int locked)
+{
+    bus.locked = locked;
+}
+
+static void pushDone(void)
+{
+    bus.done++;
+    bus.done_at = bus.count;
+}
+
+/* move one DMA item from CMAR to CPAR, item is the index of the transfer in the burst */
+static uint32_t dmaItem(DMA_Channel_TypeDef* ch, unsigned int item, volatile uint32_t** to)
+{
+    unsigned int msize = 1u << ((ch->CCR & DMA_CCR1_MSIZE) >> 10);
+    uintptr_t from = ch->CMAR + ((ch->CCR & DMA_CCR1_MINC) ? item * msize : 0);
+    uint32_t value = msize == 4 ? *(const uint32_t*)from : msize == 2 ? *(const uint16_t*)from : *(const uint8_t*)from;
+
+    CHECK(ch->CCR & DMA_CCR1_EN, "DMA channel not enabled");
+    CHECK(ch->CCR & DMA_CCR1_DIR, "DMA channel not memory to peripheral");
+    CHECK(((ch->CCR & DMA_CCR1_PSIZE) >> 8) == 2, "DMA channel peripheral size not a word");
+    ch->CNDTR--;
+    *to = (volatile uint32_t*)(uintptr_t)ch->CPAR;
+    return value;
+}
+
+/* step one burst of the write timer: its repetition counter + 1 byte periods */
+static void runBurst(void)
+{
+    TIM_TypeDef* tim = ST7529_WR_TIM;
+    DMA_Channel_TypeDef* clear = ST7529_WR_DMA_CLEAR;
+    DMA_Channel_TypeDef* set = ST7529_WR_DMA_SET;
+    unsigned int n = tim->RCR + 1, period = tim->ARR + 1, i;
+    volatile uint32_t* to;
+    uint32_t value;
+
+    cpuPinWrites();
+    CHECK(bus.selected, "burst with nCS high");
+    CHECK(nWR_CRL == nWR_CRL_TIMER, "burst with nWR not on the timer");
+    CHECK(bus.locked, "burst without the bus locked");
+    CHECK(clear->CNDTR == n && set->CNDTR == n, "DMA counts %u/%u for a burst of %u", (unsigned)clear->CNDTR,
+          (unsigned)set->CNDTR, n);
+    CHECK(tim->CCR3 < tim->CCR4 && tim->CCR4 < tim->CCR1 && tim->CCR1 < period,
+          "clear %u, set %u and nWR low %u not in order within the period %u", (unsigned)tim->CCR3,
+          (unsigned)tim->CCR4, (unsigned)tim->CCR1, period);
+    bus.bursts++;
+
+    for (i = 0; i < n; ++i)
+    {
+        /* CC3: the clear channel writes the data line mask to BRR */
+        value = dmaItem(clear, i, &to);
+        CHECK(to == &ST7529_DATA_GPIO->BRR, "clear channel not writing BRR");
+        CHECK(value == 0xff, "clear channel writing 0x%x", value);
+        bus.data &= ~value;
+
+        /* CC4: the set channel writes the byte, zero extended, to BSRR */
+        value = dmaItem(set, i, &to);
+        CHECK(to == &ST7529_DATA_GPIO->BSRR, "set channel not writing BSRR");
+        CHECK(!(value & ~0xffu), "set channel touching pins other than the data lines");
+        bus.data |= value;
+
+        /* CCR1: nWR falls, update event: nWR rises and the controller latches the data lines */
+        if (bus.count < MAX_BYTES)
+            bus.bytes[bus.count] = bus.data;
+        bus.count++;
+        bus.ns += (uint64_t)period * 1000 / tim_mhz;
+    }
+    CHECK(clear->CNDTR == 0 && set->CNDTR == 0, "DMA not done at the end of the burst");
+
+    /* one pulse mode stops the timer at the last update, which raises the interrupt */
+    tim->CR1 &= ~TIM_CR1_CEN;
+    tim->SR |= TIM_SR_UIF;
+}
+
+/* play the hardware until the push in flight completes, starting another push part way if busy_start */
+static void runPush(int busy_start)
+{
+    while (ST7529_dmaBusy())
+    {
+        uint16_t sr;
+
+        CHECK(ST7529_WR_TIM->CR1 & TIM_CR1_CEN, "push busy with the timer stopped");
+        if (!(ST7529_WR_TIM->CR1 & TIM_CR1_CEN))
+            return;
+        CHECK(!ST7529_WR_TIM->EGR || (ST7529_WR_TIM->CR1 & TIM_CR1_URS), "UG would raise an update interrupt");
+        ST7529_WR_TIM->EGR = 0;
+        runBurst();
+
+        if (busy_start && bus.bursts == 3)
+            CHECK(ST7529_dmaStartPush(fb, pushDone) == -1, "second push started while busy");
+
+        /* SR bits are cleared by writing 0, writing 1 leaves them */
+        sr = ST7529_WR_TIM->SR;
+        ST7529_WR_TIM_HANDLER();
+        sr &= ST7529_WR_TIM->SR;
+        CHECK(!(sr & TIM_SR_UIF), "update flag not cleared");
+        ST7529_WR_TIM->SR = sr;
+    }
+}
+
+/* check the timer and DMA set up for the nWR waveform */
+static void checkWaveform(void)
+{
+    TIM_TypeDef* tim = ST7529_WR_TIM;
+    unsigned int period = tim->ARR + 1;
+    unsigned int low = period - tim->CCR1;
+
+    CHECK(tim->PSC == 0, "prescaler %u", (unsigned)tim->PSC);
+    CHECK((tim->CR1 & (TIM_CR1_OPM | TIM_CR1_URS)) == (TIM_CR1_OPM | TIM_CR1_URS), "not one pulse, or UG interrupts");
+    CHECK((tim->CCMR1 & TIM_CCMR1_OC1M) == (TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1), "OC1 not in PWM mode 1");
+    CHECK((tim->CCER & (TIM_CCER_CC1E | TIM_CCER_CC1NE | TIM_CCER_CC1NP)) == TIM_CCER_CC1NE,
+          "nWR not on CH1N alone with OC1REF polarity");
+    CHECK(tim->BDTR & TIM_BDTR_MOE, "timer outputs not enabled");
+    CHECK((tim->DIER & (TIM_DIER_UIE | TIM_DIER_CC3DE | TIM_DIER_CC4DE)) ==
+          (TIM_DIER_UIE | TIM_DIER_CC3DE | TIM_DIER_CC4DE), "update interrupt or CC3/CC4 DMA requests off");
+    CHECK((ST7529_WR_DMA_CLEAR->CCR & DMA_CCR1_PL) > (ST7529_WR_DMA_SET->CCR & DMA_CCR1_PL),
+          "clear channel does not win arbitration");
+    CHECK(period * 1000 / tim_mhz >= TCYC8_NS, "byte period %uns", period * 1000 / tim_mhz);
+    CHECK(low * 1000 / tim_mhz >= TCCLW_NS, "nWR low %uns", low * 1000 / tim_mhz);
+
+    printf("waveform: %u MHz timer, %u counts per byte (%u ns), clear at %u, set at %u, nWR low %u..%u (%u ns)\n",
+           tim_mhz, period, period * 1000 / tim_mhz, (unsigned)tim->CCR3, (unsigned)tim->CCR4,
+           (unsigned)tim->CCR1, period, low * 1000 / tim_mhz);
+}
+
+/* check the bytes and windows of a push of windows first..first+count-1 and its completion */
+static void checkPush(const char* name, unsigned int first, unsigned int count)
+{
+    unsigned int i, w, at = 0, bad = 0;
+
+    for (i = 0; i < count; ++i)
+    {
+        const struct ST7529_GlassWindow* win = &ST7529_glassWindows[first + i];
+        unsigned int row, x;
+
+        CHECK(i < bus.windows && bus.window_line[i] == win->startLine && bus.window_start[i] == at,
+              "%s: window %u not addressed at line %u before its bytes", name, first + i, win->startLine);
+        for (row = 0; row < win->rows; ++row)
+        {
+            for (x = 0; x < win->pad; ++x, ++at)
+                bad += at >= bus.count || bus.bytes[at] != 0;
+            for (x = 0; x < win->rowBytes; ++x, ++at)
+                bad += at >= bus.count || bus.bytes[at] != fb[win->offset + row * LCD_USABLE_PIXELS_PER_ROW + x];
+        }
+    }
+    w = bus.windows;
+    CHECK(w == count, "%s: %u windows addressed, %u expected", name, w, count);
+    CHECK(bus.count == at, "%s: %u bytes latched, %u expected", name, bus.count, at);
+    CHECK(!bad, "%s: %u bytes out of order or wrong", name, bad);
+    CHECK(bus.done == 1 && bus.done_at == bus.count, "%s: %u completions, the last after %u of %u bytes", name,
+          bus.done, bus.done_at, bus.count);
+    CHECK(!ST7529_dmaBusy() && !bus.locked, "%s: bus not released", name);
+    CHECK(nWR_CRL == nWR_CRL_GPIO, "%s: nWR not handed back to the GPIO", name);
+    cpuPinWrites();
+    CHECK(!bus.selected, "%s: nCS left low", name);
+
+    printf("%s: %u windows, %u bytes in %u bursts, %lu us of bus time\n", name, w, bus.count, bus.bursts,
+           (unsigned long)(bus.ns / 1000));
+}
+
+/* clear what the model saw, keeping the pin levels */
+static void resetBus(void)
+{
+    int selected = bus.selected;
+    uint8_t data = bus.data;
+
+    memset(&bus, 0, sizeof(bus));
+    bus.selected = selected;
+    bus.data = data;
+}
+
+/* map an address range of the chip as plain memory */
+static void mapRange(uintptr_t base, size_t size)
+{
+    if (mmap((void*)base, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0)
+        != (void*)base)
+    {
+        fprintf(stderr, "dma_push_model: cannot map 0x%lx\n", (unsigned long)base);
+        exit(2);
+    }
+}
+
+int main(void)
+{
+    RCC_ClocksTypeDef clocks;
+    unsigned int i;
+
+    if ((uintptr_t)fb > 0xffffffffu || (uintptr_t)fb + sizeof(fb) > PERIPH_BASE)
+    {
+        fprintf(stderr, "dma_push_model: build without PIE so static data is below the peripherals\n");
+        return 2;
+    }
+    mapRange(PERIPH_BASE, 0x24000);
+    mapRange(SCS_BASE, 0x1000);
+
+    /* clocked as the firmware runs: 16MHz HSE / 2 * 9 = 72MHz, APB2 undivided */
+    RCC->CFGR = RCC_CFGR_SWS_PLL | RCC_CFGR_PLLSRC | RCC_CFGR_PLLXTPRE | RCC_CFGR_PLLMULL9 | RCC_CFGR_PPRE1_DIV2;
+    RCC_GetClocksFreq(&clocks);
+    tim_mhz = clocks.PCLK2_Frequency / 1000000;
+
+    /* as ST7529_busInit() leaves the bus */
+    ST7529_nWR_GPIO->CRL = (ST7529_nWR_GPIO->CRL & ~(0xful << (7 * 4))) | (nWR_CRL_GPIO << (7 * 4));
+
+    ST7529_dmaInit();
+    ST7529_WR_TIM->SR = 0;
+    checkWaveform();
+
+    /* every byte different from its neighbours so misordering shows */
+    for (i = 0; i < sizeof(fb); ++i)
+        fb[i] = (uint8_t)(i * 7 + i / LCD_USABLE_PIXELS_PER_ROW * 13 + 1);
+
+    resetBus();
+    CHECK(ST7529_dmaStartPush(fb, pushDone) == 0, "full push not started");
+    runPush(1);
+    checkPush("full push", 0, LCD_GLASS_WINDOW_COUNT);
+
+    resetBus();
+    CHECK(ST7529_dmaStartPushWindows(fb, 1, 1, pushDone) == 0, "window push not started");
+    runPush(0);
+    checkPush("second window", 1, 1);
+
+    resetBus();
+    CHECK(ST7529_dmaStartPushWindows(fb, 0, 99, pushDone) == 0, "clamped push not started");
+    runPush(0);
+    checkPush("count clamped", 0, LCD_GLASS_WINDOW_COUNT);
+
+    resetBus();
+    CHECK(ST7529_dmaStartPushWindows(fb, LCD_GLASS_WINDOW_COUNT, 1, pushDone) == 0 && bus.done == 1
+          && !ST7529_dmaBusy() && !bus.bursts, "empty push not completed at once");
+
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures != 0;
+}
@@ -0,0 +1,160 @@
+/*
+ * Description:
+ *
+ * Host benchmark: pixels/s of the drawing primitives of src/lcd_draw.c, the
+ * same shapes across the whole glass as the firmware's lcd_bench.c draws.
+ * The pixels of each shape are counted from the framebuffer after drawing it
+ * once, so outlines and fills are both rated in pixels.
+ *
+ *   make draw_bench && ./draw_bench [draws]
+ *
+ * The controller is modelled by lcd_model.c, nothing is pushed. The firmware
+ * is built -O0, build with CFLAGS=-O0 to compare at that level.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "simple_lcd.h"
+#include "lcd_config.h"
+#include "lcd_draw.h"
+#include "st7529_core.h"
+
+static void drawHSpan(unsigned int i)
+{
+    DrawHSpan(0, i % LCD_LINES, LCD_USABLE_PIXELS_PER_ROW, i & 1 ? WHITE : BLACK);
+}
+
+static void drawVSpan(unsigned int i)
+{
+    DrawVSpan(i % LCD_USABLE_PIXELS_PER_ROW, 0, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillRect(unsigned int i)
+{
+    DrawFillRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawRect(unsigned int i)
+{
+    DrawRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, i & 1 ? WHITE : BLACK);
+}
+
+static void drawLine(unsigned int i)
+{
+    DrawLine(0, 0, LCD_USABLE_PIXELS_PER_ROW - 1, LCD_LINES - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawCircle(unsigned int i)
+{
+    DrawCircle(LCD_USABLE_PIXELS_PER_ROW / 2, LCD_LINES / 2, LCD_LINES / 2 - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillCircle(unsigned int i)
+{
+    DrawFillCircle(LCD_USABLE_PIXELS_PER_ROW / 2, LCD_LINES / 2, LCD_LINES / 2 - 1, i & 1 ? WHITE : BLACK);
+}
+
+static void drawRoundRect(unsigned int i)
+{
+    DrawRoundRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, 8, i & 1 ? WHITE : BLACK);
+}
+
+static void drawFillRoundRect(unsigned int i)
+{
+    DrawFillRoundRect(0, 0, LCD_USABLE_PIXELS_PER_ROW, LCD_LINES, 8, i & 1 ? WHITE : BLACK);
+}
+
+static const struct
+{
+    const char* name;
+    void (*draw)(unsigned int i);
+} benches[] =
+{
+    { "hspan",      drawHSpan },
+    { "vspan",      drawVSpan },
+    { "fillrect",   drawFillRect },
+    { "rect",       drawRect },
+    { "line",       drawLine },
+    { "circle",     drawCircle },
+    { "fillcircle", drawFillCircle },
+    { "rrect",      drawRoundRect },
+    { "fillrrect",  drawFillRoundRect },
+};
+
+static double seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* the pixels of the framebuffer that are not white, at any depth */
+static unsigned int inkedPixels(void)
+{
+    const uint8_t* fb = LCDGetFramebuffer();
+    unsigned int mask = (1u << LCD_FB_BPP) - 1, count = 0, i, shift;
+
+    for (i = 0; i < LCD_FB_BYTE_CNT; ++i)
+        for (shift = 0; shift < 8; shift += LCD_FB_BPP)
+            if ((fb[i] >> shift) & mask)
+                ++count;
+    return count;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int draws = argc > 1 ? strtoul(argv[1], 0, 0) : 200000;
+    unsigned int b, i;
+
+    LCDInit();
+    while (LCDPoll()) ;
+
+    if (!LCDGetFramebuffer())
+    {
+        printf("FAIL built without a framebuffer\n");
+        return 1;
+    }
+
+    for (b = 0; b < sizeof(benches) / sizeof(benches[0]); ++b)
+    {
+        unsigned int pixels;
+        double start, s;
+
+        /* the pixels of one shape, drawn black on white */
+        LCDClear();
+        benches[b].draw(0);
+        pixels = inkedPixels();
+        if (!pixels)
+        {
+            printf("FAIL %s drew nothing\n", benches[b].name);
+            return 1;
+        }
+
+        /* black and white take turns so every draw changes the pixels */
+        start = seconds();
+        for (i = 0; i < draws; ++i)
+            benches[b].draw(i);
+        s = seconds() - start;
+
+        printf("%-10s %5u pixels x %u in %.3fs, %.0f pixels/s\n", benches[b].name, pixels, draws, s,
+               (double)pixels * draws / s);
+    }
+    return 0;
+}
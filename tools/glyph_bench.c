@@ -0,0 +1,155 @@
+/*
+ * Description:
+ *
+ * Host benchmark: glyphs/s of RenderString() in src/simple_lcd.c, which draws
+ * from the transposed glyph rows with word stores, against the per pixel
+ * Render() it replaced, kept here. Both draw the same lines of text
+ * into an 8 bit framebuffer, and their pixels are compared first.
+ *
+ *   make glyph_bench && ./glyph_bench [glyphs]
+ *
+ * The controller is modelled by lcd_model.c, nothing is pushed. The firmware
+ * is built -O0, build with CFLAGS=-O0 to compare at that level.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "simple_lcd.h"
+#include "lcd_config.h"
+#include "08x08fnt.h"
+
+#if LCD_FB_BPP != 8
+#error "the old renderer drew into an 8 bit framebuffer"
+#endif
+
+/* a line of text across the glass from x=10 */
+#define LINE_CHARS  29
+
+static uint8_t buffer[LCD_BUFFER_BYTE_CNT];
+
+/* the old renderer, one shift, mask, bounds check and store per pixel */
+static void Render(const uint8_t bitmap[8], unsigned int x, unsigned int y)
+{
+    uint8_t* fb = buffer + (y * LCD_USABLE_PIXELS_PER_ROW + x);
+
+    unsigned int top, bottom;
+    unsigned int left, right;
+
+    top = 8;
+    bottom = 0;
+
+    do
+    {
+        --top;
+        left = 0;
+        right = 8;
+
+        do
+        {
+            uint8_t val;
+            val = (bitmap[left]<<top);
+            val &= 0x80;
+
+            if (fb >= &(buffer[LCD_BUFFER_BYTE_CNT]))
+                return;
+            *fb = val?0xff:0x00;
+            fb++;
+
+            ++left;
+        } while (left != right);
+        fb += LCD_USABLE_PIXELS_PER_ROW - 8;
+
+    } while (top != bottom);
+}
+
+/* the old loop over the string, with the glyph bound of the font */
+static void oldRenderString(unsigned int x, unsigned int y, const char* string)
+{
+    while (*string != '\0')
+    {
+        char c = *string;
+        if (c < FONT_08X08_BASE || c > 126)
+            c = ' ';
+
+        Render( Font_08x08[(unsigned int)c - FONT_08X08_BASE], x, y);
+
+        x+=8;
+        ++string;
+    }
+}
+
+static double seconds(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+/* the text of line i, two texts take turns so every glyph changes */
+static const char* text(unsigned int i)
+{
+    static const char* texts[2] = {
+        "The quick brown fox jumps ov",
+        "ER THE LAZY DOG 0123456789+-",
+    };
+    return texts[i & 1];
+}
+
+/* draw lines lines of text at changing rows and x alignments, returns the seconds taken */
+static double run(void (*render)(unsigned int, unsigned int, const char*), unsigned int lines)
+{
+    double start = seconds();
+    unsigned int i;
+
+    for (i = 0; i < lines; ++i)
+        render(10 + i % 4, (i * 7) % (LCD_LINES - 7), text(i));
+    return seconds() - start;
+}
+
+int main(int argc, char** argv)
+{
+    unsigned int glyphs = argc > 1 ? strtoul(argv[1], 0, 0) : 20000000;
+    unsigned int lines = glyphs / (LINE_CHARS - 1);
+    double old_s, new_s;
+
+    LCDInit();
+    while (LCDPoll()) ;
+
+    /* the same pixels first */
+    memset(buffer, 0, sizeof(buffer));
+    LCDClear();
+    run(oldRenderString, 200);
+    run(RenderString, 200);
+    if (memcmp(buffer, LCDGetFramebuffer(), sizeof(buffer)))
+    {
+        printf("FAIL the renderers draw different pixels\n");
+        return 1;
+    }
+
+    old_s = run(oldRenderString, lines);
+    new_s = run(RenderString, lines);
+    glyphs = lines * (LINE_CHARS - 1);
+
+    printf("per pixel Render:   %u glyphs in %.3fs, %.0f glyphs/s\n", glyphs, old_s, glyphs / old_s);
+    printf("glyph rows + words: %u glyphs in %.3fs, %.0f glyphs/s\n", glyphs, new_s, glyphs / new_s);
+    printf("speedup %.1fx\n", old_s / new_s);
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Description:
+ *
+ * Host model of the LCD controller for the checks that build src/simple_lcd.c:
+ * it stands in for st7529_core.c and st7529_dma.c at the level simple_lcd.c
+ * calls them. Pushed rectangles land in the display RAM lines the glass rows
+ * show through the area scroll, and LCDModelGlassRow() reads the glass back
+ * through the same mapping. The CRC unit is a software CRC-32 and the other
+ * peripherals do nothing.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "stm32f10x.h"
+#include "st7529_core.h"
+#include "st7529_dma.h"
+#include "boot_timeline.h"
+#include "systick.h"
+#include "lcd_config.h"
+#include "lcd_model.h"
+
+#define W   LCD_USABLE_PIXELS_PER_ROW
+
+/* the controller: display RAM and the area scroll */
+static uint8_t ram[LCD_CONTROLLER_LINES][W];
+static unsigned int area_top, area_rows, area_offset;
+
+/* the controller line of framebuffer row, unscrolled */
+static unsigned int glassLine(unsigned int row)
+{
+    return row < LCD_BANK_ROWS ? LCD_BANK0_LINE + row : LCD_BANK1_LINE + row - LCD_BANK_ROWS;
+}
+
+/* the display RAM line glass row shows */
+static unsigned int shownLine(unsigned int row)
+{
+    if (area_rows && row >= area_top && row < area_top + area_rows)
+        row = area_top + (row - area_top + area_offset) % area_rows;
+    return glassLine(row);
+}
+
+/* the glass row shows */
+const uint8_t* LCDModelGlassRow(unsigned int row)
+{
+    return ram[shownLine(row)];
+}
+
+/* fill the display RAM and remove the scroll area */
+void LCDModelReset(uint8_t fill)
+{
+    memset(ram, fill, sizeof(ram));
+    area_top = area_rows = area_offset = 0;
+}
+
+/*
+ * The controller and push engine, as simple_lcd.c uses them
+ */
+int ST7529_scrollAreaValid(unsigned int top, unsigned int rows)
+{
+    return rows >= 8 && rows % 4 == 0 && glassLine(top) % 4 == 0 && top + rows <= LCD_LINES
+        && (top < LCD_BANK_ROWS) == (top + rows - 1 < LCD_BANK_ROWS);
+}
+
+int ST7529_scrollArea(unsigned int top, unsigned int rows)
+{
+    if (rows && !ST7529_scrollAreaValid(top, rows))
+        return -1;
+    area_top = top;
+    area_rows = rows;
+    area_offset = 0;
+    return 0;
+}
+
+int ST7529_scrollBy(int rows)
+{
+    int n = area_rows;
+
+    if (!n || rows % 4)
+        return -1;
+    area_offset = ((int)area_offset + rows % n + n) % n;
+    return 0;
+}
+
+int ST7529_isScrolled(void)
+{
+    return area_rows && area_offset;
+}
+
+void ST7529_rectToLCDFrom(ST7529_rowSource source, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    for (; y0 <= y1; ++y0)
+        memcpy(&ram[shownLine(y0)][x0], source(y0, x0, x1 - x0 + 1), x1 - x0 + 1);
+}
+
+static const uint8_t* rect_buffer;
+static const uint8_t* bufferRow(unsigned int row, unsigned int first, unsigned int count)
+{
+    return rect_buffer + row * W + first;
+}
+
+void ST7529_rectToLCD(uint8_t* bufferMem, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+{
+    rect_buffer = bufferMem;
+    ST7529_rectToLCDFrom(bufferRow, x0, y0, x1, y1);
+}
+
+int ST7529_dmaStartPush(const uint8_t* bufferMem, ST7529_pushDoneCallback done)
+{
+    if (ST7529_isScrolled())
+    {
+        fprintf(stderr, "lcd_model: background push with the display RAM scrolled\n");
+        exit(1);
+    }
+    ST7529_rectToLCD((uint8_t*)bufferMem, 0, 0, W - 1, LCD_LINES - 1);
+    if (done)
+        done();
+    return 0;
+}
+
+void ST7529_dmaInit(void) {}
+int ST7529_dmaBusy(void) { return 0; }
+void ST7529_initStart(void) {}
+int ST7529_poll(void) { return 0; }
+int ST7529_ready(void) { return 1; }
+int ST7529_busy(void) { return 0; }
+void ST7529_busInit(void) {}
+int ST7529_calibrateBus(void) { return 0; }
+void ST7529_writeContrast(uint16_t contrast) {}
+void BootTimelineMark(boot_event_t event) {}
+
+uint32_t getCycleCount(void)
+{
+    static uint32_t cycles;
+    return cycles += 10;
+}
+
+/* the CRC unit: CRC-32 over words, MSB first */
+static uint32_t crc_dr;
+void CRC_ResetDR(void)
+{
+    crc_dr = 0xffffffff;
+}
+
+uint32_t CRC_CalcBlockCRC(uint32_t pBuffer[], uint32_t BufferLength)
+{
+    uint32_t i, bit;
+
+    for (i = 0; i < BufferLength; ++i)
+    {
+        crc_dr ^= pBuffer[i];
+        for (bit = 0; bit < 32; ++bit)
+            crc_dr = crc_dr & 0x80000000 ? (crc_dr << 1) ^ 0x04c11db7 : crc_dr << 1;
+    }
+    return crc_dr;
+}
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState) {}
+void RCC_APB2PeriphClockCmd(uint32_t RCC_APB2Periph, FunctionalState NewState) {}
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct) {}
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal) {}
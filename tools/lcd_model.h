@@ -0,0 +1,32 @@
+/*
+ * Description:
+ *
+ * Host model of the LCD controller for the checks that build src/simple_lcd.c
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __LCD_MODEL_H__
+#define __LCD_MODEL_H__
+
+#include <stdint.h>
+
+/* the display RAM row glass row shows, LCD_USABLE_PIXELS_PER_ROW gray bytes */
+const uint8_t* LCDModelGlassRow(unsigned int row);
+/* fill the display RAM with a byte and remove the scroll area */
+void LCDModelReset(uint8_t fill);
+
+#endif // __LCD_MODEL_H__
@@ -0,0 +1,212 @@
+/*
+ * Description:
+ *
+ * Host tool: convert a PGM gray scale image to the raw or run length encoded
+ * image format of src/image.h, written out as C source.
+ *
+ *   cc -o pgm2image pgm2image.c
+ *   ./pgm2image [-r|-p] [-b bpp] name < image.pgm > name.c
+ *
+ *   -r     run length encode the image
+ *   -p     keep the packed rows raw
+ *          (default: whichever is smaller)
+ *   -b     bits per pixel, 1, 2, 4 or 8 (default 8)
+ *
+ * PGM white becomes the panel's white. 1, 2 and 4 bit images get evenly spaced
+ * gray levels, 8 bit images the controller's gray bytes. Images may be at most
+ * 256 pixels wide.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define MAX_WIDTH   256
+
+/* the controller's black gray byte */
+#define BLACK       0xfc
+
+/* the stream of output bytes for one encoding */
+struct Out
+{
+    uint8_t* bytes;
+    unsigned int count, size;
+};
+
+static void put(struct Out* out, uint8_t b)
+{
+    if (out->count == out->size)
+    {
+        out->size = out->size ? out->size * 2 : 1024;
+        out->bytes = realloc(out->bytes, out->size);
+        if (!out->bytes)
+        {
+            fprintf(stderr, "pgm2image: out of memory\n");
+            exit(1);
+        }
+    }
+    out->bytes[out->count++] = b;
+}
+
+/* the next number of a PGM header, skipping white space and comments */
+static int headerNumber(FILE* f)
+{
+    int c, n = 0;
+
+    while ((c = getc(f)) != EOF)
+    {
+        if (c == '#')
+            while ((c = getc(f)) != EOF && c != '\n') ;
+        else if (c >= '0' && c <= '9')
+            break;
+    }
+    if (c == EOF)
+        return -1;
+    for (; c >= '0' && c <= '9'; c = getc(f))
+        n = n * 10 + c - '0';
+    return n;
+}
+
+/* runs of repeated bytes are packed as a count and the byte, everything else copied after a count */
+static void encodeRLE(struct Out* out, const uint8_t* in, unsigned int count)
+{
+    unsigned int i = 0;
+
+    while (i < count)
+    {
+        unsigned int run = 1, literal;
+
+        while (i + run < count && run < 129 && in[i + run] == in[i])
+            ++run;
+        if (run >= 2)
+        {
+            put(out, run + 126);
+            put(out, in[i]);
+            i += run;
+            continue;
+        }
+
+        /* copy up to the next run of at least three bytes, a run of two costs the same either way */
+        for (literal = 1; i + literal < count && literal < 128; ++literal)
+            if (i + literal + 2 < count && in[i + literal] == in[i + literal + 1]
+                && in[i + literal] == in[i + literal + 2])
+                break;
+        put(out, literal - 1);
+        for (; literal; --literal)
+            put(out, in[i++]);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    struct Out raw = { 0 }, rle = { 0 }, *out;
+    const char* name = 0;
+    int mode = 0, bpp = 8, binary, width, height, maxval, i;
+    unsigned int x, y;
+    char magic[3] = { 0 };
+
+    for (i = 1; i < argc; ++i)
+    {
+        if (!strcmp(argv[i], "-r"))
+            mode = 'r';
+        else if (!strcmp(argv[i], "-p"))
+            mode = 'p';
+        else if (!strcmp(argv[i], "-b") && i + 1 < argc)
+            bpp = atoi(argv[++i]);
+        else
+            name = argv[i];
+    }
+    if (!name || (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8))
+    {
+        fprintf(stderr, "usage: pgm2image [-r|-p] [-b bpp] name < image.pgm > name.c\n");
+        return 1;
+    }
+
+    if (fread(magic, 1, 2, stdin) != 2 || magic[0] != 'P' || (magic[1] != '2' && magic[1] != '5'))
+    {
+        fprintf(stderr, "pgm2image: not a PGM image\n");
+        return 1;
+    }
+    binary = magic[1] == '5';
+    width = headerNumber(stdin);
+    height = headerNumber(stdin);
+    maxval = headerNumber(stdin);
+    if (width <= 0 || height <= 0 || maxval <= 0 || maxval > 255)
+    {
+        fprintf(stderr, "pgm2image: bad PGM header\n");
+        return 1;
+    }
+    if (width > MAX_WIDTH || height > 0xffff)
+    {
+        fprintf(stderr, "pgm2image: images may be at most %d pixels wide\n", MAX_WIDTH);
+        return 1;
+    }
+
+    /* the pixels packed into rows, bpp bits each, MSB first */
+    for (y = 0; y < (unsigned int)height; ++y)
+    {
+        uint8_t b = 0;
+        int n = 0;
+
+        for (x = 0; x < (unsigned int)width; ++x)
+        {
+            int v = binary ? getc(stdin) : headerNumber(stdin);
+            int dark;
+
+            if (v < 0)
+            {
+                fprintf(stderr, "pgm2image: the image is cut short\n");
+                return 1;
+            }
+            dark = maxval - v;
+            if (bpp == 8)
+                v = (dark * BLACK + maxval / 2) / maxval;
+            else
+                v = (dark * ((1 << bpp) - 1) + maxval / 2) / maxval;
+
+            b = (b << bpp) | v;
+            n += bpp;
+            if (n == 8)
+            {
+                put(&raw, b);
+                b = 0;
+                n = 0;
+            }
+        }
+        if (n)
+            put(&raw, b << (8 - n));
+    }
+
+    encodeRLE(&rle, raw.bytes, raw.count);
+    if (!mode)
+        mode = rle.count < raw.count ? 'r' : 'p';
+    out = mode == 'r' ? &rle : &raw;
+
+    printf("/*\n * Description:\n *\n * Image %s, %dx%d, %d bit%s per pixel, %s.\n", name, width, height, bpp,
+           bpp > 1 ? "s" : "", mode == 'r' ? "run length encoded" : "raw");
+    printf(" * Generated by tools/pgm2image, do not edit.\n */\n");
+    printf("#include \"image.h\"\n\n");
+    printf("static const uint8_t %s_data[%u] = {", name, out->count);
+    for (i = 0; i < (int)out->count; ++i)
+        printf("%s0x%02x,", i % 12 ? " " : "\n    ", out->bytes[i]);
+    printf("\n};\n\n");
+    printf("const struct Image %s = {\n    %d, %d, %d, %s, %s_data\n};\n", name, width, height, bpp,
+           mode == 'r' ? "IMAGE_RLE" : "IMAGE_RAW", name);
+    return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Description:
+ *
+ * Host check: run LCDScrollRegion() of src/simple_lcd.c, both the hardware area
+ * scroll and the framebuffer fallback, against a model of the controller's
+ * display RAM and area scroll, and check the glass matches what was drawn after
+ * every push, with and without row hashing, and after a background push.
+ *
+ *   make scroll_check && ./scroll_check
+ *
+ * The controller is modelled by lcd_model.c.
+ *
+ * License:
+ *
+ * Copyright 2012 Crystalfontz America, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "simple_lcd.h"
+#include "st7529_core.h"
+#include "lcd_config.h"
+#include "lcd_model.h"
+
+#define W   LCD_USABLE_PIXELS_PER_ROW
+
+/* what the glass should show */
+static uint8_t expect[LCD_LINES][W];
+
+static unsigned int failures, checks;
+
+#define CHECK(COND, ...) do { ++checks; if (!(COND)) { ++failures; printf("FAIL %s:%d: ", __FILE__, __LINE__); \
+    printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+/* fill a rectangle in both the framebuffer and what the glass should show */
+static void fill(unsigned int x, unsigned int y, unsigned int w, unsigned int h, uint8_t gray)
+{
+    unsigned int row;
+
+    LCDFillRect(x, y, w, h, gray);
+    for (row = y; row < y + h; ++row)
+        memset(&expect[row][x], gray, w);
+}
+
+/* a different mark on every row so moved rows show */
+static void drawRows(void)
+{
+    unsigned int row;
+
+    fill(0, 0, W, LCD_LINES, WHITE);
+    for (row = 0; row < LCD_LINES; ++row)
+        fill((row * 37) % (W - 20), row, 3 + row % 17, 1, BLACK);
+}
+
+/* scroll rows y..y+h-1 of what the glass should show by n */
+static void scrollExpect(unsigned int y, unsigned int h, int n)
+{
+    unsigned int shift = n < 0 ? -n : n, row;
+
+    if (n > 0)
+        for (row = y; row < y + h - shift; ++row)
+            memcpy(expect[row], expect[row + shift], W);
+    else
+        for (row = y + h - 1; row >= y + shift; --row)
+            memcpy(expect[row], expect[row - shift], W);
+    for (row = n > 0 ? y + h - shift : y; shift--; ++row)
+        memset(expect[row], WHITE, W);
+}
+
+/* push and compare the glass with what was drawn */
+static void checkGlass(const char* what)
+{
+    unsigned int row, bad = 0;
+
+    PushBuffer();
+    for (row = 0; row < LCD_LINES; ++row)
+        if (memcmp(LCDModelGlassRow(row), expect[row], W))
+        {
+            if (!bad)
+                printf("  %s: first wrong row %u\n", what, row);
+            bad++;
+        }
+    CHECK(!bad, "%s: %u glass rows wrong", what, bad);
+}
+
+/* scroll, check which way it went and the glass */
+static void scroll(const char* what, unsigned int y, unsigned int h, int n, int hw)
+{
+    int ret = LCDScrollRegion(y, h, n);
+
+    CHECK(ret == hw, "%s: scrolled by %s", what, ret ? "the controller" : "redrawing");
+    scrollExpect(y, h, n);
+    checkGlass(what);
+}
+
+static void run(int hashing)
+{
+    printf("row hashing %s\n", hashing ? "on" : "off");
+    LCDModelReset(0x55);
+    LCDSetRowHashing(hashing);
+    drawRows();
+    checkGlass("drawn");
+
+#if !LCD_DOUBLE_BUFFER
+    /* a background push, before any area scroll, sends the whole frame past the row hashes. A row drawn
+     * back as it was last hashed still has to go out */
+    fill(0, 50, W, 1, BLACK);
+    checkGlass("hashed before a background push");
+    fill(0, 50, W, 1, WHITE);
+    PushBufferAsync(0);
+    fill(0, 50, W, 1, BLACK);
+    checkGlass("drawn back after a background push");
+#endif
+
+    /* the fallback: rows, shifts and bands the controller cannot scroll */
+    scroll("fallback up 1", 3, 11, 1, 0);
+    scroll("fallback down 3", 20, 30, -3, 0);
+    scroll("fallback across the banks", 30, 8, 4, 0);
+    scroll("fallback up 5 in a block band", 2, 16, 5, 0);
+
+    /* the controller: whole 4 line blocks of one bank, by multiples of 4 */
+    scroll("area up 4", 2, 16, 4, 1);
+    scroll("area up 8 again", 2, 16, 8, 1);
+    scroll("area down 4", 2, 16, -4, 1);
+    scroll("fallback inside the scrolled area", 5, 6, 2, 0);
+
+    /* a new area puts the old one back unscrolled, its rows have to be sent again */
+    scroll("new area in the other bank", 36, 24, 4, 1);
+    scroll("back to the first area", 2, 16, 4, 1);
+    scroll("area over the first bank", 2, 32, -8, 1);
+
+    /* scrolling the whole band away clears it */
+    fill(0, 40, W, 1, BLACK);
+    scroll("whole band", 40, 8, 8, 0);
+
+    /* direct drawing keeps working on the scrolled rows */
+    fill(17, 3, 40, 20, BLACK);
+    checkGlass("drawn on the scrolled area");
+}
+
+int main(void)
+{
+    LCDInit();
+    while (LCDPoll()) ;
+
+    run(0);
+    run(1);
+
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures != 0;
+}